@@ -0,0 +1,464 @@
+/**
+ * @file bench_bares.cpp
+ * @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+ * @date 18 Outubro 2026
+ * @brief Microbenchmarks de cada estágio do BARES sobre expressões
+ *        sintéticas.
+ *
+ * Uso: bench [--lines N] [--repeat R] [--seed S] [--shape NOME]
+ *
+ * O formato "incremental" mede edições pequenas em uma expressão longa, o
+ * "formula" uma expressão com variáveis avaliada sobre muitas linhas e os
+ * "tree" e "lex" uma única expressão muito grande avaliada e lida em
+ * paralelo.
+ */
+
+#include <algorithm> // std::max
+#include <atomic>    // std::atomic
+#include <chrono>    // std::chrono::steady_clock
+#include <cstdio>    // std::printf
+#include <cstdlib>   // std::malloc, std::free
+#include <cstring>   // std::strcmp
+#include <functional>// std::function
+#include <random>    // std::mt19937
+#include <new>       // std::bad_alloc
+#include <streambuf> // std::streambuf
+#include <string>    // std::string
+#include <thread>    // std::thread::hardware_concurrency
+#include <vector>    // std::vector
+
+#include "tokenizer.h"
+#include "bares.h"
+#include "bytecode.h"
+#include "evaluator.h"
+#include "batch_eval.h"
+#include "jit.h"
+#include "incremental.h"
+#include "formula.h"
+#include "tree_eval.h"
+#include "parallel_tokenizer.h"
+#include "generators.h"
+
+//<! Número de chamadas a operator new desde o início do programa.
+static std::atomic< std::size_t > g_allocs( 0 );
+
+void * operator new( std::size_t n_ )
+{
+    g_allocs.fetch_add( 1, std::memory_order_relaxed );
+    if ( void * p = std::malloc( n_ ? n_ : 1 ) )
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete( void * p_ ) noexcept
+{  std::free( p_ ); }
+
+void operator delete( void * p_, std::size_t ) noexcept
+{  std::free( p_ ); }
+
+namespace {
+
+    using clock_type = std::chrono::steady_clock;
+
+    /**
+     * @brief      Fluxo de saída que descarta tudo (para medir sem E/S)
+     */
+    class NullBuffer : public std::streambuf
+    {
+        protected:
+            int_type overflow( int_type c_ ) override
+            {  return c_; }
+
+            std::streamsize xsputn( const char *, std::streamsize n_ ) override
+            {  return n_; }
+    };
+
+    /**
+     * @brief      Parâmetros da execução
+     */
+    struct Config
+    {
+        std::size_t lines = 20000;  //<! Expressões geradas por formato.
+        std::size_t repeat = 5;     //<! Passadas medidas sobre as expressões.
+        std::uint32_t seed = 2017;  //<! Semente dos geradores.
+        const char * shape = nullptr; //<! Apenas este formato (nullptr = todos).
+    };
+
+    //<! Uma passada de aquecimento e `repeat` passadas medidas; imprime a linha do relatório
+    void measure( const char * shape_, const char * stage_, std::size_t n_, std::size_t repeat_,
+                  const std::function< void() > & pass_ )
+    {
+        if ( n_ == 0 )
+            return;
+
+        pass_(); //Aquecimento: caches, arenas e vetores chegam ao tamanho final
+
+        std::size_t allocs = g_allocs.load( std::memory_order_relaxed );
+        auto start = clock_type::now();
+        for ( std::size_t r = 0; r < repeat_; ++r )
+            pass_();
+        auto elapsed = std::chrono::duration< double, std::nano >( clock_type::now() - start ).count();
+        allocs = g_allocs.load( std::memory_order_relaxed ) - allocs;
+
+        const double total = double( n_ ) * double( repeat_ );
+        std::printf( "%-11s %-17s %12.1f %14.0f %14.3f\n",
+                     shape_, stage_, elapsed / total, total / ( elapsed * 1e-9 ), double( allocs ) / total );
+    }
+
+    //<! Mede todos os estágios sobre as expressões de um formato
+    //<! Parsing e cálculo com a largura Int e a política de overflow Policy
+    template < typename Int, typename Policy >
+    void measure_width( const char * shape_, const char * stage_,
+                        const std::vector< std::string > & lines_, std::size_t repeat_ )
+    {
+        BasicTokenizer< Int > parser;
+        BasicBares< Int, Policy > bares;
+        volatile std::size_t sink = 0;
+
+        measure( shape_, stage_, lines_.size(), repeat_, [&]{
+            for ( const auto & l : lines_ )
+                if ( parser.parse( l ).type == ParseResult::OK )
+                    sink = sink + bares.evaluate( parser.get_tokens() ).type_b;
+        } );
+    }
+
+    void run_shape( gen::shape_t shape_, const Config & cfg_ )
+    {
+        const char * name = gen::name( shape_ );
+        const auto lines = gen::generate( shape_, cfg_.lines, cfg_.seed );
+
+        //Tokens das expressões válidas, usados pelos estágios seguintes
+        Tokenizer parser;
+        std::vector< std::vector< Token > > valid;
+        for ( const auto & l : lines )
+            if ( parser.parse( l ).type == Tokenizer::Result::OK )
+                valid.push_back( parser.get_tokens() );
+
+        volatile std::size_t sink = 0; //Impede que o compilador descarte o trabalho
+
+        measure( name, "parse", lines.size(), cfg_.repeat, [&]{
+            for ( const auto & l : lines )
+                sink = sink + parser.parse( l ).type;
+        } );
+
+        //get_tokens() devolve uma referência; o custo medido é o da cópia
+        //que quem guarda os Tokens faz (subtraia a linha "parse")
+        std::vector< Token > copy;
+        measure( name, "parse+get_tokens", lines.size(), cfg_.repeat, [&]{
+            for ( const auto & l : lines )
+            {
+                parser.parse( l );
+                copy = parser.get_tokens();
+                sink = sink + copy.size();
+            }
+        } );
+
+        Bares bares;
+        measure( name, "infix_to_postfix", valid.size(), cfg_.repeat, [&]{
+            for ( const auto & t : valid )
+            {
+                bares.infix_to_postfix( t );
+                sink = sink + bares.postfix().size();
+            }
+        } );
+
+        //Só o cálculo: as formas posfixas são montadas antes da medição
+        std::vector< std::vector< Token > > postfixes;
+        for ( const auto & t : valid )
+        {
+            bares.infix_to_postfix( t );
+            postfixes.emplace_back( bares.postfix().begin(), bares.postfix().end() );
+        }
+        measure( name, "evaluate", valid.size(), cfg_.repeat, [&]{
+            for ( const auto & p : postfixes )
+                sink = sink + bares.evaluate_postfix( p.data(), p.size() ).type_b;
+        } );
+
+        //A mesma linha com outras larguras e políticas (a primeira é o Bares padrão)
+        measure_width< std::int16_t, overflow::Error >( name, "p+e i16/error", lines, cfg_.repeat );
+        measure_width< std::int32_t, overflow::Saturate >( name, "p+e i32/saturate", lines, cfg_.repeat );
+        measure_width< std::int64_t, overflow::Wrap >( name, "p+e i64/wrap", lines, cfg_.repeat );
+        measure_width< __int128, overflow::Error >( name, "p+e i128/error", lines, cfg_.repeat );
+
+        bc::Program program;
+        bc::VM vm;
+        measure( name, "compile+vm", valid.size(), cfg_.repeat, [&]{
+            for ( const auto & t : valid )
+            {
+                bares.infix_to_postfix( t );
+                bc::compile( bares.postfix(), program );
+                sink = sink + vm.run( program ).type_b;
+            }
+        } );
+
+        //Os mesmos programas agrupados por formato e avaliados com SIMD
+        BatchEvaluator batch;
+        std::vector< Bares::Result > results;
+        measure( name, "postfix+batch", valid.size(), cfg_.repeat, [&]{
+            batch.clear();
+            for ( const auto & t : valid )
+            {
+                bares.infix_to_postfix( t );
+                batch.add( bares.postfix() );
+            }
+            batch.run( results );
+            sink = sink + results.size();
+        } );
+
+        //Código nativo por formato, com o interpretador para o que não compila
+        jit::Cache jit_cache;
+        measure( name, "postfix+jit", valid.size(), cfg_.repeat, [&]{
+            for ( const auto & t : valid )
+            {
+                bares.infix_to_postfix( t );
+                Bares::Result r;
+                if ( not jit_cache.run( bares.postfix(), r ) )
+                {
+                    bc::compile( bares.postfix(), program );
+                    r = vm.run( program );
+                }
+                sink = sink + r.type_b;
+            }
+        } );
+
+        NullBuffer null_buf;
+        std::ostream null_os( &null_buf );
+        Evaluator evaluator;
+        measure( name, "end-to-end", lines.size(), cfg_.repeat, [&]{
+            for ( const auto & l : lines )
+                evaluator.eval( l, null_os );
+        } );
+
+        EvalOptions fused_options;
+        fused_options.fused = true;
+        Evaluator fused( fused_options );
+        measure( name, "end-to-end(fused)", lines.size(), cfg_.repeat, [&]{
+            for ( const auto & l : lines )
+                fused.eval( l, null_os );
+        } );
+    }
+
+    //<! Expressão balanceada com n_ constantes de dois dígitos; guarda a posição de cada uma
+    std::string balanced( std::size_t n_, std::mt19937 & rng_, std::vector< std::size_t > & literals_ )
+    {
+        if ( n_ == 1 )
+        {
+            literals_.push_back( 0 );
+            return std::to_string( 10 + rng_() % 90 );
+        }
+
+        std::vector< std::size_t > right;
+        std::string l = balanced( n_ / 2, rng_, literals_ );
+        std::string r = balanced( n_ - n_ / 2, rng_, right );
+        std::string e = "(" + l + ( rng_() % 2 ? " + " : " - " ) + r + ")";
+
+        //Posições relativas ao novo texto
+        const std::size_t first = literals_.size() - ( n_ / 2 );
+        for ( std::size_t i = first; i < literals_.size(); ++i )
+            literals_[i] += 1;
+        for ( auto p : right )
+            literals_.push_back( p + 1 + l.size() + 3 );
+        return e;
+    }
+
+    //<! Troca de uma constante em uma expressão longa: parsing completo x IncrementalEvaluator
+    void run_incremental( const Config & cfg_ )
+    {
+        std::mt19937 rng( cfg_.seed );
+        std::vector< std::size_t > literals;
+        std::string expr = balanced( std::max< std::size_t >( cfg_.lines / 4, 1 ), rng, literals );
+
+        //As mesmas edições nas duas medidas: constante na posição p vira outra de dois dígitos
+        std::vector< std::pair< std::size_t, std::string > > edits;
+        for ( std::size_t i = 0; i < 1000; ++i )
+            edits.emplace_back( literals[ rng() % literals.size() ], std::to_string( 10 + rng() % 90 ) );
+
+        volatile std::size_t sink = 0;
+        Tokenizer parser;
+        Bares bares;
+        std::string text = expr;
+        measure( "incremental", "full reparse", edits.size(), cfg_.repeat, [&]{
+            for ( const auto & e : edits )
+            {
+                text.replace( e.first, 2, e.second );
+                if ( parser.parse( text ).type == Tokenizer::Result::OK )
+                    sink = sink + bares.evaluate( parser.get_tokens() ).value_b;
+            }
+        } );
+
+        IncrementalEvaluator inc;
+        inc.load( expr );
+        measure( "incremental", "edit", edits.size(), cfg_.repeat, [&]{
+            for ( const auto & e : edits )
+            {
+                inc.edit( e.first, 2, e.second );
+                sink = sink + inc.value().value_b;
+            }
+        } );
+
+        if ( inc.value().value_b != bares.evaluate( parser.get_tokens() ).value_b )
+            std::fprintf( stderr, "incremental: resultado diferente do parsing completo!\n" );
+    }
+
+    //<! Fórmula sobre muitas linhas: valores substituídos no texto x Formula compilada uma vez
+    void run_formula( const Config & cfg_ )
+    {
+        const char * expr = "a * x + b - ( c % 7 ) * x";
+        std::mt19937 rng( cfg_.seed );
+        std::vector< std::vector< std::int16_t > > columns( 4, std::vector< std::int16_t >( cfg_.lines ) );
+        for ( auto & c : columns )
+            for ( auto & v : c )
+                v = static_cast< std::int16_t >( int( rng() % 201 ) - 100 );
+
+        Formula formula;
+        formula.compile( expr );
+        std::vector< const Formula::value_type * > bound;
+        for ( const auto & name : formula.variables() )
+            bound.push_back( columns[ name == "a" ? 0 : name == "x" ? 1 : name == "b" ? 2 : 3 ].data() );
+
+        //Cada linha vira uma expressão de texto, como quem não tem variáveis faria
+        volatile std::size_t sink = 0;
+        Tokenizer parser;
+        Bares bares;
+        std::string text;
+        measure( "formula", "substitute+p+e", cfg_.lines, cfg_.repeat, [&]{
+            for ( std::size_t i = 0; i < cfg_.lines; ++i )
+            {
+                text.clear();
+                text += std::to_string( columns[0][i] ) + " * " + std::to_string( columns[1][i] ) + " + "
+                      + std::to_string( columns[2][i] ) + " - ( " + std::to_string( columns[3][i] ) + " % 7 ) * "
+                      + std::to_string( columns[1][i] );
+                if ( parser.parse( text ).type == Tokenizer::Result::OK )
+                    sink = sink + bares.evaluate( parser.get_tokens() ).value_b;
+            }
+        } );
+
+        std::vector< Formula::value_type > values;
+        std::vector< std::uint8_t > codes;
+        measure( "formula", "formula(columns)", cfg_.lines, cfg_.repeat, [&]{
+            formula.evaluate( bound, cfg_.lines, values, codes );
+            sink = sink + values.size();
+        } );
+    }
+
+    //<! Soma de 10 * lines constantes e produtos "(a * b)"; o sinal de cada
+    //<! termo leva a soma de volta a 0, para que não haja overflow
+    std::string huge_expression( const Config & cfg_ )
+    {
+        std::mt19937 rng( cfg_.seed );
+        std::string expr = "0";
+        long sum = 0;
+        for ( std::size_t i = 0; i < cfg_.lines * 10; ++i )
+        {
+            const long a = 1 + rng() % 99, b = 1 + rng() % 9;
+            const bool product = i % 2 == 1;
+            const long term = product ? a * b : a;
+            expr += sum > 0 ? " - " : " + ";
+            expr += product ? "(" + std::to_string( a ) + " * " + std::to_string( b ) + ")" : std::to_string( a );
+            sum += sum > 0 ? -term : term;
+        }
+        return expr;
+    }
+
+    //<! Pools de 1, 2, 4, ... trabalhadores, até o número de núcleos
+    void for_each_pool_size( const std::function< void( std::size_t ) > & f_ )
+    {
+        const std::size_t cores = std::max( 1u, std::thread::hardware_concurrency() );
+        for ( std::size_t n = 1; ; n = std::min( n * 2, cores ) )
+        {
+            f_( n );
+            if ( n == cores )
+                break;
+        }
+    }
+
+    //<! Uma expressão muito grande: Bares::evaluate x TreeEvaluator com 1, 2, ... threads
+    void run_tree( const Config & cfg_ )
+    {
+        const std::string expr = huge_expression( cfg_ );
+        Tokenizer parser;
+        parser.parse( expr );
+        const auto & tokens = parser.get_tokens();
+
+        volatile std::size_t sink = 0;
+        Bares bares;
+        measure( "tree", "bares", 1, cfg_.repeat, [&]{
+            sink = sink + bares.evaluate( tokens ).value_b;
+        } );
+
+        for_each_pool_size( [&]( std::size_t n_ ){
+            WorkStealingPool pool( n_ );
+            TreeEvaluator tree( pool );
+            const std::string stage = "tree(" + std::to_string( n_ ) + " thr)";
+            measure( "tree", stage.c_str(), 1, cfg_.repeat, [&]{
+                sink = sink + tree.evaluate( tokens ).value_b;
+            } );
+
+            if ( tree.evaluate( tokens ).value_b != bares.evaluate( tokens ).value_b )
+                std::fprintf( stderr, "tree: resultado diferente de Bares::evaluate!\n" );
+        } );
+    }
+
+    //<! Parsing da mesma expressão: Tokenizer x ParallelTokenizer com 1, 2, ... threads
+    void run_lex( const Config & cfg_ )
+    {
+        const std::string expr = huge_expression( cfg_ );
+
+        volatile std::size_t sink = 0;
+        Tokenizer parser;
+        measure( "lex", "parse", 1, cfg_.repeat, [&]{
+            sink = sink + parser.parse( expr ).type;
+        } );
+
+        for_each_pool_size( [&]( std::size_t n_ ){
+            WorkStealingPool pool( n_ );
+            ParallelTokenizer lexer( pool );
+            const std::string stage = "parallel(" + std::to_string( n_ ) + " thr)";
+            measure( "lex", stage.c_str(), 1, cfg_.repeat, [&]{
+                sink = sink + lexer.parse( expr ).type;
+            } );
+
+            if ( lexer.get_tokens().size() != parser.get_tokens().size() )
+                std::fprintf( stderr, "lex: Tokens diferentes dos de Tokenizer::parse!\n" );
+        } );
+    }
+}
+
+int main( int argc, char * argv[] )
+{
+    Config cfg;
+    for ( int i = 1; i < argc; ++i )
+    {
+        if ( std::strcmp( argv[i], "--lines" ) == 0 and i + 1 < argc )
+            cfg.lines = std::stoul( argv[++i] );
+        else if ( std::strcmp( argv[i], "--repeat" ) == 0 and i + 1 < argc )
+            cfg.repeat = std::stoul( argv[++i] );
+        else if ( std::strcmp( argv[i], "--seed" ) == 0 and i + 1 < argc )
+            cfg.seed = static_cast< std::uint32_t >( std::stoul( argv[++i] ) );
+        else if ( std::strcmp( argv[i], "--shape" ) == 0 and i + 1 < argc )
+            cfg.shape = argv[++i];
+        else
+        {
+            std::fprintf( stderr, "Uso: %s [--lines N] [--repeat R] [--seed S] [--shape NOME]\n", argv[0] );
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::printf( "%-11s %-17s %12s %14s %14s\n", "shape", "stage", "ns/expr", "expr/s", "allocs/expr" );
+
+    const gen::shape_t shapes[] = { gen::shape_t::FLAT, gen::shape_t::NESTED, gen::shape_t::POWER,
+                                    gen::shape_t::ERRORS, gen::shape_t::WHITESPACE, gen::shape_t::TEMPLATED };
+    for ( auto s : shapes )
+        if ( cfg.shape == nullptr or std::strcmp( cfg.shape, gen::name( s ) ) == 0 )
+            run_shape( s, cfg );
+    if ( cfg.shape == nullptr or std::strcmp( cfg.shape, "incremental" ) == 0 )
+        run_incremental( cfg );
+    if ( cfg.shape == nullptr or std::strcmp( cfg.shape, "formula" ) == 0 )
+        run_formula( cfg );
+    if ( cfg.shape == nullptr or std::strcmp( cfg.shape, "tree" ) == 0 )
+        run_tree( cfg );
+    if ( cfg.shape == nullptr or std::strcmp( cfg.shape, "lex" ) == 0 )
+        run_lex( cfg );
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,86 @@
+#!/usr/bin/env bash
+#
+# @file daemon_load.sh
+# @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+# @date 18 Outubro 2026
+# @brief Teste de carga do modo servidor (--serve), todo na mesma máquina.
+#
+# Gera um corpus com o gen_corpus, divide-o em lotes e compara, com C
+# clientes simultâneos:
+#   fork/exec       um processo ./parser por lote (o uso atual)
+#   connect/lote    um ./parser --connect por lote, no mesmo servidor
+#   persistente     uma única conexão por cliente para todos os lotes
+# A saída de cada cliente é conferida com a do modo sequencial.
+#
+# Uso: bench/daemon_load.sh [-c CLIENTES] [-n LINHAS] [-b LINHAS_POR_LOTE] [-t THREADS]
+
+set -eu
+
+CLIENTS=4
+LINES=200000
+BATCH=1000
+THREADS=2
+while getopts "c:n:b:t:" opt; do
+    case "$opt" in
+        c) CLIENTS=$OPTARG ;;
+        n) LINES=$OPTARG ;;
+        b) BATCH=$OPTARG ;;
+        t) THREADS=$OPTARG ;;
+        *) echo "Uso: $0 [-c CLIENTES] [-n LINHAS] [-b LINHAS_POR_LOTE] [-t THREADS]" >&2; exit 1 ;;
+    esac
+done
+
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+PARSER=$ROOT/build/bin/parser
+GEN=$ROOT/build/bin/gen_corpus
+for bin in "$PARSER" "$GEN"; do
+    [ -x "$bin" ] || { echo "$bin não encontrado (make && make tools)" >&2; exit 1; }
+done
+
+WORK=$(mktemp -d)
+SOCKET=$WORK/bares.sock
+SERVER_PID=
+cleanup() {
+    [ -n "$SERVER_PID" ] && kill "$SERVER_PID" 2>/dev/null && wait "$SERVER_PID" 2>/dev/null
+    rm -rf "$WORK"
+}
+trap cleanup EXIT
+
+"$GEN" --lines "$LINES" --seed 1 --output "$WORK/corpus.txt"
+"$PARSER" < "$WORK/corpus.txt" > "$WORK/expected.txt"
+mkdir "$WORK/batches"
+split -a 6 -l "$BATCH" "$WORK/corpus.txt" "$WORK/batches/b"
+N_BATCHES=$(ls "$WORK/batches" | wc -l)
+
+"$PARSER" --serve "$SOCKET" --threads "$THREADS" &
+SERVER_PID=$!
+for _ in $(seq 50); do [ -S "$SOCKET" ] && break; sleep 0.1; done
+[ -S "$SOCKET" ] || { echo "o servidor não criou $SOCKET" >&2; exit 1; }
+
+# Executa "$1" em cada um dos clientes e informa o tempo e a vazão
+run_mode() {
+    local name=$1 fn=$2
+    local start end
+    start=$(date +%s.%N)
+    for c in $(seq "$CLIENTS"); do
+        "$fn" > "$WORK/out.$c" &
+    done
+    wait $(jobs -p | grep -v "^$SERVER_PID\$")
+    end=$(date +%s.%N)
+
+    local status=ok
+    for c in $(seq "$CLIENTS"); do
+        cmp -s "$WORK/out.$c" "$WORK/expected.txt" || status=DIFERENTE
+    done
+    awk -v n="$name" -v s="$start" -v e="$end" -v l=$(( LINES * CLIENTS )) -v st="$status" \
+        'BEGIN { printf "%-16s %10.3f s %12.0f linhas/s  %s\n", n, e - s, l / (e - s), st }'
+}
+
+fork_exec()    { for f in "$WORK"/batches/*; do "$PARSER" < "$f"; done; }
+connect_each() { for f in "$WORK"/batches/*; do "$PARSER" --connect "$SOCKET" < "$f"; done; }
+persistent()   { cat "$WORK"/batches/* | "$PARSER" --connect "$SOCKET"; }
+
+echo "$CLIENTS clientes x $LINES linhas em $N_BATCHES lotes de $BATCH; servidor com $THREADS threads"
+run_mode "fork/exec" fork_exec
+run_mode "connect/lote" connect_each
+run_mode "persistente" persistent
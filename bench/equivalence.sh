@@ -0,0 +1,100 @@
+#!/usr/bin/env bash
+#
+# @file equivalence.sh
+# @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+# @date 18 Outubro 2026
+# @brief Confere que os modos alternativos de avaliação escrevem exatamente
+#        a mesma saída do modo sequencial.
+#
+# Monta um corpus com o gen_corpus (todos os tipos de erro e constantes
+# perto de ±32767) e os casos de expr/, grava a saída esperada (a do
+# Evaluator, e resultado.txt para exp.txt) e compara com ela, linha a
+# linha, a saída do parser em cada modo:
+#   sequencial      o caminho padrão
+#   --batch         grupos por formato avaliados com SIMD
+#   --jit           código nativo dos formatos frequentes
+#   --tree          cada linha lida (ParallelTokenizer) e avaliada
+#                   (TreeEvaluator) em paralelo
+#
+# Uso: bench/equivalence.sh [-n LINHAS] [-s SEMENTE]
+
+set -eu
+
+LINES=200000
+SEED=1
+while getopts "n:s:" opt; do
+    case "$opt" in
+        n) LINES=$OPTARG ;;
+        s) SEED=$OPTARG ;;
+        *) echo "Uso: $0 [-n LINHAS] [-s SEMENTE]" >&2; exit 1 ;;
+    esac
+done
+
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+PARSER=$ROOT/build/bin/parser
+GEN=$ROOT/build/bin/gen_corpus
+for bin in "$PARSER" "$GEN"; do
+    [ -x "$bin" ] || { echo "$bin não encontrado (make && make tools)" >&2; exit 1; }
+done
+
+WORK=$(mktemp -d)
+trap 'rm -rf "$WORK"' EXIT
+
+# Linhas curtas: cada tipo de erro e muitas constantes nos limites de int16
+"$GEN" --lines "$LINES" --seed "$SEED" --edge 0.3 --spaces 2 \
+       --error end=0.02 --error ill_formed=0.02 --error missing_term=0.02 \
+       --error extraneous=0.02 --error missing_paren=0.02 --error out_of_range=0.02 \
+       --error div_zero=0.04 --error overflow=0.08 \
+       --output "$WORK/input.txt" --expected "$WORK/expected.txt"
+
+# Poucos formatos, repetidos: o --jit compila quase todos (com divisões
+# por zero e overflows dentro do código gerado)
+"$GEN" --lines "$(( LINES / 4 ))" --seed "$SEED" --terms 3:3 --depth 0 --paren 0 \
+       --ops "+:3,-:3,*:2,/:1,%:1" --edge 0.3 --error div_zero=0.1 --error overflow=0.2 \
+       --output "$WORK/part.txt" --expected "$WORK/part.expected"
+cat "$WORK/part.txt" >> "$WORK/input.txt"
+cat "$WORK/part.expected" >> "$WORK/expected.txt"
+
+# Linhas com milhares de termos (acima do GRAIN do --tree), com parênteses
+# aninhados, erros e overflows no meio das cadeias
+"$GEN" --lines 24 --seed "$SEED" --terms 2000:4000 --depth 1 --paren 0.0003 --edge 0.3 \
+       --error end=0.05 --error missing_term=0.05 --error missing_paren=0.05 \
+       --error extraneous=0.05 --error div_zero=0.1 --error overflow=0.2 \
+       --output "$WORK/part.txt" --expected "$WORK/part.expected"
+cat "$WORK/part.txt" >> "$WORK/input.txt"
+cat "$WORK/part.expected" >> "$WORK/expected.txt"
+
+# Linhas de 128 KiB ou mais (o ParallelTokenizer as divide em blocos de
+# 64 KiB): cada termo do nível de fora é um "( ... )" com ~130 termos
+"$GEN" --lines 32 --seed "$SEED" --terms 110:170 --depth 1 --paren 1 --spaces 6 --edge 0.3 \
+       --error end=0.05 --error missing_term=0.05 --error missing_paren=0.05 \
+       --error extraneous=0.05 --error div_zero=0.1 --error overflow=0.2 \
+       --output "$WORK/part.txt" --expected "$WORK/part.expected"
+cat "$WORK/part.txt" >> "$WORK/input.txt"
+cat "$WORK/part.expected" >> "$WORK/expected.txt"
+
+# Casos de expr/ (awk 1 garante o '\n' da última linha)
+awk 1 "$ROOT/expr/exp.txt" >> "$WORK/input.txt"
+awk 1 "$ROOT/expr/resultado.txt" >> "$WORK/expected.txt"
+
+# Compara a saída do parser com os argumentos dados com a esperada
+FAILED=0
+check() {
+    local name=${*:-sequencial}
+    "$PARSER" "$@" < "$WORK/input.txt" > "$WORK/got.txt"
+    if cmp -s "$WORK/got.txt" "$WORK/expected.txt"; then
+        printf "%-24s ok\n" "$name"
+    else
+        printf "%-24s DIFERENTE (%s)\n" "$name" \
+               "$(cmp "$WORK/got.txt" "$WORK/expected.txt" 2>&1 | sed 's/.*, //')"
+        FAILED=1
+    fi
+}
+
+echo "$(wc -l < "$WORK/input.txt") linhas"
+check
+check --batch
+check --jit
+check --tree --threads 2
+
+exit $FAILED
@@ -0,0 +1,169 @@
+/**
+ * @file generators.cpp
+ * @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+ * @date 18 Outubro 2026
+ * @brief Arquivo com a implementação dos geradores de expressões sintéticas.
+ */
+
+#include "generators.h"
+
+#include <random> // std::mt19937
+
+namespace {
+    using rng_t = std::mt19937;
+
+    //<! Inteiro uniforme em [lo, hi]
+    int uniform( rng_t & rng_, int lo_, int hi_ )
+    {
+        return std::uniform_int_distribution< int >( lo_, hi_ )( rng_ );
+    }
+
+    //<! Um dos operadores binários
+    char any_operator( rng_t & rng_ )
+    {
+        static const char ops[] = { '+', '-', '*', '/', '%', '^' };
+        return ops[ uniform( rng_, 0, 5 ) ];
+    }
+
+    //<! Cadeia com 32 a 96 termos, só com "+", "-" e "*" para quase não estourar
+    std::string flat( rng_t & rng_ )
+    {
+        static const char ops[] = { '+', '-', '*', '+', '-' };
+        std::string e = std::to_string( uniform( rng_, 1, 99 ) );
+        for ( int i = uniform( rng_, 32, 96 ); i > 0; --i )
+        {
+            e += ' ';
+            e += ops[ uniform( rng_, 0, 4 ) ];
+            e += ' ';
+            e += std::to_string( uniform( rng_, 1, 9 ) );
+        }
+        return e;
+    }
+
+    //<! ((((a op b) op c) op d) ...) com 16 a 64 níveis
+    std::string nested( rng_t & rng_ )
+    {
+        int depth = uniform( rng_, 16, 64 );
+        std::string e( depth, '(' );
+        e += std::to_string( uniform( rng_, 1, 9 ) );
+        for ( int i = 0; i < depth; ++i )
+        {
+            e += ( uniform( rng_, 0, 1 ) ? '+' : '-' );
+            e += std::to_string( uniform( rng_, 1, 9 ) );
+            e += ')';
+        }
+        return e;
+    }
+
+    //<! Torres a ^ b ^ c ... com bases pequenas (-1, 0, 1, 2) e de 4 a 16 andares
+    std::string power( rng_t & rng_ )
+    {
+        std::string e;
+        for ( int i = uniform( rng_, 4, 16 ); i > 0; --i )
+        {
+            e += std::to_string( uniform( rng_, -1, 2 ) );
+            e += '^';
+        }
+        e += std::to_string( uniform( rng_, 0, 3 ) );
+        return e;
+    }
+
+    //<! Uma expressão com erro escolhido ao acaso
+    std::string error( rng_t & rng_ )
+    {
+        std::string a = std::to_string( uniform( rng_, 1, 999 ) );
+        std::string b = std::to_string( uniform( rng_, 1, 999 ) );
+        switch ( uniform( rng_, 0, 7 ) )
+        {
+            case 0: return a + " " + any_operator( rng_ );                 // Faltando termo.
+            case 1: return a + " + " + b + " " + b;                          // Símbolo estranho.
+            case 2: return a + " + #" + b;                                   // Inteiro mal formado.
+            case 3: return "((" + a + " * " + b + ") - 1";                   // Faltando ")".
+            case 4: return a + "000000 + " + b;                              // Fora do intervalo.
+            case 5: return "   \t  ";                                        // Final inesperado.
+            case 6: return a + " / (" + b + " - " + b + ")";                 // Divisão por zero.
+            default: return "200 * " + std::to_string( uniform( rng_, 200, 999 ) ); // Sobrecarga.
+        }
+    }
+
+    //<! Expressão comum com 1 a 8 espaços/tabs entre todos os símbolos
+    std::string whitespace( rng_t & rng_ )
+    {
+        auto pad = [&rng_]( std::string & e_ ){
+            for ( int i = uniform( rng_, 1, 8 ); i > 0; --i )
+                e_ += ( uniform( rng_, 0, 3 ) ? ' ' : '\t' );
+        };
+
+        std::string e;
+        pad( e );
+        e += std::to_string( uniform( rng_, 1, 999 ) );
+        for ( int i = uniform( rng_, 4, 16 ); i > 0; --i )
+        {
+            pad( e );
+            e += ( uniform( rng_, 0, 1 ) ? '+' : '-' );
+            pad( e );
+            e += '(';
+            pad( e );
+            e += std::to_string( uniform( rng_, 1, 99 ) );
+            pad( e );
+            e += '*';
+            pad( e );
+            e += std::to_string( uniform( rng_, 1, 9 ) );
+            pad( e );
+            e += ')';
+        }
+        pad( e );
+        return e;
+    }
+
+    //<! Um de 8 formatos fixos, como os gerados por um sistema que preenche modelos
+    std::string templated( rng_t & rng_ )
+    {
+        static const char * forms[] = { "# * # + #", "(# - #) * #", "# / # + # % #", "# * # * # - #",
+                                        "# + # + # + # + #", "(# + #) / (# - #)", "# ^ # - #", "# % # * #" };
+        std::string e;
+        for ( const char * c = forms[ uniform( rng_, 0, 7 ) ]; *c; ++c )
+            if ( *c == '#' )
+                e += std::to_string( uniform( rng_, -300, 300 ) );
+            else
+                e += *c;
+        return e;
+    }
+}
+
+//<! Nome do formato
+const char * gen::name( shape_t shape_ )
+{
+    switch ( shape_ )
+    {
+        case shape_t::FLAT       : return "flat";
+        case shape_t::NESTED     : return "nested";
+        case shape_t::POWER      : return "power";
+        case shape_t::ERRORS     : return "errors";
+        case shape_t::WHITESPACE : return "whitespace";
+        case shape_t::TEMPLATED  : return "templated";
+    }
+    return "?";
+}
+
+//<! Gera n expressões do formato pedido
+std::vector< std::string > gen::generate( shape_t shape_, std::size_t n_, std::uint32_t seed_ )
+{
+    rng_t rng( seed_ );
+    std::vector< std::string > out;
+    out.reserve( n_ );
+
+    for ( std::size_t i = 0; i < n_; ++i )
+    {
+        switch ( shape_ )
+        {
+            case shape_t::FLAT       : out.push_back( flat( rng ) ); break;
+            case shape_t::NESTED     : out.push_back( nested( rng ) ); break;
+            case shape_t::POWER      : out.push_back( power( rng ) ); break;
+            case shape_t::ERRORS     : out.push_back( error( rng ) ); break;
+            case shape_t::WHITESPACE : out.push_back( whitespace( rng ) ); break;
+            case shape_t::TEMPLATED  : out.push_back( templated( rng ) ); break;
+        }
+    }
+    return out;
+}
@@ -0,0 +1,48 @@
+/**
+ * @file generators.h
+ * @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+ * @date 18 Outubro 2026
+ * @brief Arquivo contendo os geradores de expressões sintéticas usadas
+ *        pelos benchmarks.
+ */
+
+#ifndef _GENERATORS_H_
+#define _GENERATORS_H_
+
+#include <cstdint> // std::uint32_t
+#include <string>  // std::string
+#include <vector>  // std::vector
+
+namespace gen {
+
+    /**
+     * @brief      Formatos de expressão disponíveis
+     */
+    enum class shape_t
+    {
+        FLAT,       // Cadeias longas sem parênteses: 1 + 2 * 3 - 4 ...
+        NESTED,     // Parênteses profundamente aninhados.
+        POWER,      // Torres de potência, associadas pela direita.
+        ERRORS,     // Erros de sintaxe e de cálculo de todos os tipos.
+        WHITESPACE, // Expressões comuns com muitos espaços e tabs.
+        TEMPLATED   // Poucos formatos fixos (a * b + c, ...) com constantes variadas.
+    };
+
+    /**
+     * @brief      Nome do formato (para relatórios)
+     */
+    const char * name( shape_t shape_ );
+
+    /**
+     * @brief      Gera n_ expressões do formato pedido
+     *
+     * @param[in]  shape_  O formato
+     * @param[in]  n_      Número de expressões
+     * @param[in]  seed_   Semente do gerador pseudoaleatório
+     *
+     * @return     As expressões, uma por elemento
+     */
+    std::vector< std::string > generate( shape_t shape_, std::size_t n_, std::uint32_t seed_ );
+}
+
+#endif
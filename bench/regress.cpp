@@ -0,0 +1,362 @@
+/**
+ * @file regress.cpp
+ * @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+ * @date 18 Outubro 2026
+ * @brief Teste de regressão de vazão sobre o corpus de expr/: amplia os
+ *        casos existentes, confere a saída e compara com uma linha de base.
+ *
+ * Uso: regress [--lines N] [--seed S] [--corpus DIR] [--baseline ARQUIVO]
+ *              [--threshold PCT] [--update] [--fused] [--cache BYTES]
+ *              [--exec PARSER] [--exec-args "ARGS"]
+ */
+
+#include <algorithm> // std::nth_element
+#include <chrono>    // std::chrono::steady_clock
+#include <cstdio>    // std::printf
+#include <cstdlib>   // std::system
+#include <cstring>   // std::strcmp
+#include <fstream>   // std::ifstream, std::ofstream
+#include <map>       // std::map
+#include <random>    // std::mt19937
+#include <sstream>   // std::ostringstream
+#include <string>    // std::string
+#include <unistd.h>  // mkstemp, close, unlink
+#include <vector>    // std::vector
+
+#include "tokenizer.h"
+#include "bares.h"
+#include "evaluator.h"
+
+namespace {
+
+    using clock_type = std::chrono::steady_clock;
+
+    /**
+     * @brief      Parâmetros da execução
+     */
+    struct Config
+    {
+        std::size_t lines = 1000000;                 //<! Linhas do corpus ampliado.
+        std::uint32_t seed = 2017;                   //<! Semente da mistura.
+        std::string corpus = "expr";                 //<! Diretório do corpus.
+        std::string baseline = "bench/baseline.txt"; //<! Arquivo da linha de base.
+        double threshold = 10.0;                     //<! Queda de vazão tolerada (%).
+        bool update = false;                         //<! Regrava a linha de base.
+        EvalOptions options;                         //<! Opções do avaliador.
+        std::string exec;                            //<! Executável a medir (opcional).
+        std::string exec_args;                       //<! Argumentos do executável.
+    };
+
+    /**
+     * @brief      Um caso do corpus: entrada e saída esperada (sem '\n')
+     */
+    struct Case
+    {
+        std::string input;
+        std::string expected;
+    };
+
+    /**
+     * @brief      Fluxo de saída que acumula tudo numa string
+     */
+    class StringBuffer : public std::streambuf
+    {
+        public:
+            std::string data;
+
+        protected:
+            int_type overflow( int_type c_ ) override
+            {
+                if ( c_ != traits_type::eof() )
+                    data += static_cast< char >( c_ );
+                return c_;
+            }
+
+            std::streamsize xsputn( const char * s_, std::streamsize n_ ) override
+            {
+                data.append( s_, static_cast< std::size_t >( n_ ) );
+                return n_;
+            }
+    };
+
+    //<! Lê as linhas de um arquivo (a última pode não ter '\n')
+    std::vector< std::string > read_lines( const std::string & path_ )
+    {
+        std::ifstream in( path_ );
+        std::vector< std::string > lines;
+        std::string l;
+        while ( std::getline( in, l ) )
+            lines.push_back( l );
+        return lines;
+    }
+
+    //<! Saída de referência: Tokenizer + Bares::evaluate, sem bytecode
+    std::string reference( const std::string & line_ )
+    {
+        Tokenizer parser;
+        std::ostringstream os;
+        auto result = parser.parse( line_ );
+        if ( result.type != Tokenizer::Result::OK )
+            print_msg( os, result );
+        else
+        {
+            Bares bares;
+            auto r = bares.evaluate( parser.get_tokens() );
+            if ( r.type_b != Bares::Result::OK )
+                print_msg_bares( os, r );
+            else
+                os << r.value_b << '\n';
+        }
+
+        std::string s = os.str();
+        s.pop_back();
+        return s;
+    }
+
+    //<! Monta os casos: exp.txt com resultado.txt; teste.txt e verificar.txt com a referência
+    bool load_cases( const Config & cfg_, std::vector< Case > & cases_ )
+    {
+        auto inputs = read_lines( cfg_.corpus + "/exp.txt" );
+        auto outputs = read_lines( cfg_.corpus + "/resultado.txt" );
+        if ( inputs.empty() or inputs.size() != outputs.size() )
+        {
+            std::fprintf( stderr, "regress: %s/exp.txt e resultado.txt ausentes ou de tamanhos diferentes\n",
+                          cfg_.corpus.c_str() );
+            return false;
+        }
+
+        for ( std::size_t i = 0; i < inputs.size(); ++i )
+        {
+            //A referência precisa concordar com as saídas guardadas
+            if ( reference( inputs[i] ) != outputs[i] )
+            {
+                std::fprintf( stderr, "regress: referência diverge de resultado.txt na linha %zu: \"%s\"\n",
+                              i + 1, inputs[i].c_str() );
+                return false;
+            }
+            cases_.push_back( Case{ inputs[i], outputs[i] } );
+        }
+
+        for ( const char * extra : { "/teste.txt", "/verificar.txt" } )
+            for ( auto & l : read_lines( cfg_.corpus + extra ) )
+                cases_.push_back( Case{ l, reference( l ) } );
+
+        return true;
+    }
+
+    //<! Lê a linha de base ("chave valor" por linha; '#' inicia comentário)
+    std::map< std::string, double > read_baseline( const std::string & path_ )
+    {
+        std::map< std::string, double > values;
+        std::ifstream in( path_ );
+        std::string key;
+        double value;
+        while ( in >> key )
+        {
+            if ( key[0] == '#' )
+                std::getline( in, key );
+            else if ( in >> value )
+                values[ key ] = value;
+        }
+        return values;
+    }
+
+    //<! Grava a linha de base
+    bool write_baseline( const std::string & path_, const std::map< std::string, double > & values_ )
+    {
+        std::ofstream out( path_ );
+        out << "# Linha de base de bench/regress (gerada com --update)\n";
+        for ( const auto & kv : values_ )
+            out << kv.first << ' ' << static_cast< long long >( kv.second ) << '\n';
+        return bool( out );
+    }
+
+    //<! Percentil p (0-100) das latências
+    double percentile( std::vector< std::uint32_t > & lat_, double p_ )
+    {
+        std::size_t k = static_cast< std::size_t >( p_ / 100.0 * double( lat_.size() - 1 ) );
+        std::nth_element( lat_.begin(), lat_.begin() + k, lat_.end() );
+        return lat_[k];
+    }
+
+    //<! Primeira linha em que as saídas diferem (a partir de 1)
+    std::size_t first_mismatch( const std::string & got_, const std::string & expected_ )
+    {
+        std::size_t line = 1;
+        for ( std::size_t i = 0; i < got_.size() and i < expected_.size(); ++i )
+        {
+            if ( got_[i] != expected_[i] )
+                return line;
+            if ( got_[i] == '\n' )
+                ++line;
+        }
+        return line;
+    }
+
+    //<! Executa o binário sobre a entrada; devolve a vazão, ou 0 se a saída estiver errada
+    double run_exec( const Config & cfg_, const std::string & input_, const std::string & expected_ )
+    {
+        char in_path[] = "/tmp/bares_regress_inXXXXXX";
+        char out_path[] = "/tmp/bares_regress_outXXXXXX";
+        int in_fd = mkstemp( in_path ), out_fd = mkstemp( out_path );
+        if ( in_fd < 0 or out_fd < 0 )
+        {
+            std::perror( "regress: mkstemp" );
+            return 0;
+        }
+        close( in_fd );
+        close( out_fd );
+        std::ofstream( in_path, std::ios::binary ) << input_;
+
+        std::string cmd = "'" + cfg_.exec + "' " + cfg_.exec_args + " < " + in_path + " > " + out_path;
+        auto start = clock_type::now();
+        int rc = std::system( cmd.c_str() );
+        double secs = std::chrono::duration< double >( clock_type::now() - start ).count();
+
+        std::ifstream out( out_path, std::ios::binary );
+        std::string got( ( std::istreambuf_iterator< char >( out ) ), std::istreambuf_iterator< char >() );
+        unlink( in_path );
+        unlink( out_path );
+
+        if ( rc != 0 or got != expected_ )
+        {
+            std::fprintf( stderr, "regress: saída de %s difere na linha %zu (código %d)\n",
+                          cfg_.exec.c_str(), first_mismatch( got, expected_ ), rc );
+            return 0;
+        }
+        return double( cfg_.lines ) / secs;
+    }
+}
+
+int main( int argc, char * argv[] )
+{
+    Config cfg;
+    for ( int i = 1; i < argc; ++i )
+    {
+        if ( std::strcmp( argv[i], "--lines" ) == 0 and i + 1 < argc )
+            cfg.lines = std::stoul( argv[++i] );
+        else if ( std::strcmp( argv[i], "--seed" ) == 0 and i + 1 < argc )
+            cfg.seed = static_cast< std::uint32_t >( std::stoul( argv[++i] ) );
+        else if ( std::strcmp( argv[i], "--corpus" ) == 0 and i + 1 < argc )
+            cfg.corpus = argv[++i];
+        else if ( std::strcmp( argv[i], "--baseline" ) == 0 and i + 1 < argc )
+            cfg.baseline = argv[++i];
+        else if ( std::strcmp( argv[i], "--threshold" ) == 0 and i + 1 < argc )
+            cfg.threshold = std::stod( argv[++i] );
+        else if ( std::strcmp( argv[i], "--update" ) == 0 )
+            cfg.update = true;
+        else if ( std::strcmp( argv[i], "--fused" ) == 0 )
+            cfg.options.fused = true;
+        else if ( std::strcmp( argv[i], "--cache" ) == 0 and i + 1 < argc )
+            cfg.options.cache_bytes = std::stoul( argv[++i] );
+        else if ( std::strcmp( argv[i], "--exec" ) == 0 and i + 1 < argc )
+            cfg.exec = argv[++i];
+        else if ( std::strcmp( argv[i], "--exec-args" ) == 0 and i + 1 < argc )
+            cfg.exec_args = argv[++i];
+        else
+        {
+            std::fprintf( stderr, "Uso: %s [--lines N] [--seed S] [--corpus DIR] [--baseline ARQUIVO]\n"
+                                  "          [--threshold PCT] [--update] [--fused] [--cache BYTES]\n"
+                                  "          [--exec PARSER] [--exec-args \"ARGS\"]\n", argv[0] );
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::vector< Case > cases;
+    if ( not load_cases( cfg, cases ) or cfg.lines == 0 )
+        return EXIT_FAILURE;
+
+    //Mistura reprodutível dos casos existentes
+    std::mt19937 rng( cfg.seed );
+    std::uniform_int_distribution< std::size_t > pick( 0, cases.size() - 1 );
+    std::vector< std::size_t > order( cfg.lines );
+    std::string input, expected;
+    for ( auto & k : order )
+    {
+        k = pick( rng );
+        input += cases[k].input;
+        input += '\n';
+        expected += cases[k].expected;
+        expected += '\n';
+    }
+
+    //Caminho da biblioteca: latência de cada linha
+    StringBuffer buf;
+    buf.data.reserve( expected.size() );
+    std::ostream os( &buf );
+    Evaluator evaluator( cfg.options );
+    std::vector< std::uint32_t > lat( cfg.lines );
+
+    auto start = clock_type::now();
+    for ( std::size_t i = 0; i < cfg.lines; ++i )
+    {
+        auto t0 = clock_type::now();
+        evaluator.eval( cases[ order[i] ].input, os );
+        auto t1 = clock_type::now();
+        lat[i] = static_cast< std::uint32_t >( std::chrono::duration_cast< std::chrono::nanoseconds >( t1 - t0 ).count() );
+    }
+    double secs = std::chrono::duration< double >( clock_type::now() - start ).count();
+
+    if ( buf.data != expected )
+    {
+        std::fprintf( stderr, "regress: saída da biblioteca difere na linha %zu\n",
+                      first_mismatch( buf.data, expected ) );
+        return EXIT_FAILURE;
+    }
+
+    std::map< std::string, double > current;
+    current["lines"] = double( cfg.lines );
+    current["throughput"] = double( cfg.lines ) / secs;
+    current["p50_ns"] = percentile( lat, 50 );
+    current["p99_ns"] = percentile( lat, 99 );
+
+    if ( not cfg.exec.empty() )
+    {
+        double tput = run_exec( cfg, input, expected );
+        if ( tput == 0 )
+            return EXIT_FAILURE;
+        current["exec_throughput"] = tput;
+    }
+
+    //Relatório e comparação com a linha de base
+    auto base = read_baseline( cfg.baseline );
+    bool ok = true;
+    std::printf( "%-16s %14s %14s %9s\n", "metric", "current", "baseline", "delta" );
+    for ( const auto & kv : current )
+    {
+        auto b = base.find( kv.first );
+        if ( b == base.end() or b->second == 0 )
+        {
+            std::printf( "%-16s %14.0f %14s %9s\n", kv.first.c_str(), kv.second, "-", "-" );
+            continue;
+        }
+
+        double delta = 100.0 * ( kv.second - b->second ) / b->second;
+        std::printf( "%-16s %14.0f %14.0f %+8.1f%%\n", kv.first.c_str(), kv.second, b->second, delta );
+
+        //Só a vazão reprova a execução; as latências são informativas
+        bool is_throughput = kv.first.find( "throughput" ) != std::string::npos;
+        if ( is_throughput and delta < -cfg.threshold )
+            ok = false;
+    }
+
+    if ( cfg.update or base.empty() )
+    {
+        if ( not write_baseline( cfg.baseline, current ) )
+        {
+            std::fprintf( stderr, "regress: não foi possível gravar %s\n", cfg.baseline.c_str() );
+            return EXIT_FAILURE;
+        }
+        std::printf( "linha de base gravada em %s\n", cfg.baseline.c_str() );
+        return EXIT_SUCCESS;
+    }
+
+    if ( not ok )
+    {
+        std::printf( "FALHOU: vazão caiu mais de %.1f%% em relação a %s\n", cfg.threshold, cfg.baseline.c_str() );
+        return EXIT_FAILURE;
+    }
+
+    std::printf( "OK\n" );
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,151 @@
+/**
+ * @file arena.h
+ * @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+ * @date 18 Outubro 2026
+ * @brief Arquivo contendo as definições da arena de memória e do alocador
+ *        que a utiliza.
+ */
+
+#ifndef _ARENA_H_
+#define _ARENA_H_
+
+#include <cstddef> // std::size_t, std::max_align_t
+#include <memory>  // std::unique_ptr
+#include <vector>  // std::vector
+
+namespace ls{
+
+    /**
+     * @brief      Arena de alocação sequencial (bump allocator).
+     *
+     *             Os pedidos são servidos em ordem a partir de blocos grandes
+     *             e nunca liberados individualmente: rewind() devolve tudo de
+     *             uma vez. Quando um ciclo precisou de mais de um bloco, eles
+     *             são trocados por um único bloco com a soma dos tamanhos, de
+     *             modo que os ciclos seguintes do mesmo porte não alocam nada.
+     */
+    class Arena
+    {
+        public:
+            /**
+             * @brief      Cria a arena (o primeiro bloco só é alocado no
+             *             primeiro pedido)
+             *
+             * @param[in]  block_size_  Tamanho mínimo de cada bloco, em bytes
+             */
+            explicit Arena( std::size_t block_size_ = 4096 );
+
+            /**
+             * @brief      Reserva bytes_ bytes alinhados a align_
+             *
+             * @param[in]  bytes_  Número de bytes
+             * @param[in]  align_  Alinhamento (potência de 2, até max_align_t)
+             *
+             * @return     Ponteiro para a memória reservada
+             */
+            void * allocate( std::size_t bytes_, std::size_t align_ );
+
+            /**
+             * @brief      Devolve toda a memória reservada desde o último rewind()
+             */
+            void rewind( void );
+
+            /**
+             * @brief      Total de bytes em blocos
+             */
+            std::size_t capacity( void ) const;
+
+            //==== Métodos Especiais
+
+            /**
+             * @brief      Construtor Cópia (removido)
+             */
+            Arena( const Arena & ) = delete;
+
+            /**
+             * @brief      Atribuição (removida)
+             */
+            Arena & operator=( const Arena & ) = delete;
+
+        private:
+            /**
+             * @brief      Bloco de memória da arena
+             */
+            struct Block
+            {
+                std::unique_ptr< std::max_align_t[] > data; //<! Área do bloco.
+                std::size_t size;                           //<! Tamanho em bytes.
+            };
+
+            std::vector< Block > blocks; //<! Blocos; o último é o atual.
+            std::size_t offset;          //<! Primeiro byte livre do bloco atual.
+            std::size_t block_size;      //<! Tamanho mínimo de cada bloco.
+
+            /**
+             * @brief      Acrescenta um bloco com pelo menos bytes_ bytes
+             */
+            void grow( std::size_t bytes_ );
+    };
+
+    /**
+     * @brief      Alocador de containers padrão que reserva da Arena.
+     *
+     *             deallocate() não faz nada: a memória volta para a arena
+     *             em Arena::rewind().
+     */
+    template < typename T >
+    class ArenaAllocator
+    {
+        public:
+            //=== Alias
+            using value_type = T;
+
+            /**
+             * @brief      Cria o alocador sobre a arena
+             *
+             * @param      arena_  A arena (deve viver mais que o container)
+             */
+            explicit ArenaAllocator( Arena * arena_ ) noexcept
+                : m_arena( arena_ )
+            { /* empty */ }
+
+            /**
+             * @brief      Conversão entre alocadores de tipos diferentes
+             */
+            template < typename U >
+            ArenaAllocator( const ArenaAllocator< U > & other_ ) noexcept
+                : m_arena( other_.arena() )
+            { /* empty */ }
+
+            /**
+             * @brief      Reserva espaço para n_ elementos
+             */
+            T * allocate( std::size_t n_ )
+            {  return static_cast< T * >( m_arena->allocate( n_ * sizeof( T ), alignof( T ) ) ); }
+
+            /**
+             * @brief      Não faz nada (ver Arena::rewind())
+             */
+            void deallocate( T *, std::size_t ) noexcept
+            { /* empty */ }
+
+            /**
+             * @brief      A arena usada
+             */
+            Arena * arena( void ) const noexcept
+            {  return m_arena; }
+
+            template < typename U >
+            bool operator==( const ArenaAllocator< U > & other_ ) const noexcept
+            {  return m_arena == other_.arena(); }
+
+            template < typename U >
+            bool operator!=( const ArenaAllocator< U > & other_ ) const noexcept
+            {  return m_arena != other_.arena(); }
+
+        private:
+            Arena * m_arena; //<! A arena.
+    };
+}
+
+#endif
@@ -0,0 +1,233 @@
+/**
+ * @file arithmetic.h
+ * @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+ * @date 18 Outubro 2026
+ * @brief Operações aritméticas inteiras com detecção exata de overflow.
+ *
+ * Todas as funções calculam o resultado com precisão infinita e o guardam
+ * no tipo de destino R; retornam true quando o resultado não cabe em R.
+ */
+
+#ifndef _ARITHMETIC_H_
+#define _ARITHMETIC_H_
+
+#include <cstdint>     // std::int16_t, ...
+#include <limits>      // std::numeric_limits
+#include <type_traits> // std::make_unsigned
+
+namespace arith {
+
+    /**
+     * @brief      Tipo sem sinal com a mesma largura de T (std::make_unsigned
+     *             não cobre __int128 no modo -std=c++17 estrito)
+     */
+    template < typename T >
+    struct unsigned_of {  using type = typename std::make_unsigned< T >::type; };
+
+    template <>
+    struct unsigned_of< __int128 > {  using type = unsigned __int128; };
+
+    template < typename T >
+    using unsigned_of_t = typename unsigned_of< T >::type;
+
+    /**
+     * @brief      Converte o valor para o tipo de destino
+     *
+     * @param[in]  v_    Valor a ser convertido
+     * @param[out] r_    Valor convertido
+     *
+     * @return     True se o valor não cabe em R, False caso contrário
+     */
+    template < typename R, typename T >
+    inline bool narrow( T v_, R & r_ )
+    {  return __builtin_add_overflow( v_, T(0), &r_ ); }
+
+    /**
+     * @brief      Soma com verificação de overflow
+     *
+     * @return     True se houve overflow, False caso contrário
+     */
+    template < typename R, typename T >
+    inline bool add( T a_, T b_, R & r_ )
+    {  return __builtin_add_overflow( a_, b_, &r_ ); }
+
+    /**
+     * @brief      Subtração com verificação de overflow
+     *
+     * @return     True se houve overflow, False caso contrário
+     */
+    template < typename R, typename T >
+    inline bool sub( T a_, T b_, R & r_ )
+    {  return __builtin_sub_overflow( a_, b_, &r_ ); }
+
+    /**
+     * @brief      Multiplicação com verificação de overflow
+     *
+     * @return     True se houve overflow, False caso contrário
+     */
+    template < typename R, typename T >
+    inline bool mul( T a_, T b_, R & r_ )
+    {  return __builtin_mul_overflow( a_, b_, &r_ ); }
+
+    /**
+     * @brief      Divisão com verificação de overflow (o único caso é
+     *             mínimo / -1, que não é avaliado para não gerar UB)
+     *
+     * @return     True se houve overflow, False caso contrário
+     */
+    template < typename R, typename T >
+    inline bool div( T a_, T b_, R & r_ )
+    {  return b_ == -1 ? sub( T(0), a_, r_ ) : narrow( a_ / b_, r_ ); }
+
+    /**
+     * @brief      Resto da divisão (nunca estoura; x % -1 é sempre 0)
+     *
+     * @return     Sempre False
+     */
+    template < typename R, typename T >
+    inline bool mod( T a_, T b_, R & r_ )
+    {  return b_ == -1 ? ( r_ = 0, false ) : narrow( a_ % b_, r_ ); }
+
+    /**
+     * @brief      Converte o módulo e o sinal lidos de uma constante
+     *
+     * @param[in]  mag_       O módulo
+     * @param[in]  negative_  Se a constante é negativa
+     * @param[out] r_         O valor com sinal
+     *
+     * @return     True se o valor não cabe em R, False caso contrário
+     */
+    template < typename R, typename U >
+    inline bool from_magnitude( U mag_, bool negative_, R & r_ )
+    {
+        using UR = unsigned_of_t< R >;
+        constexpr UR max = static_cast< UR >( std::numeric_limits< R >::max() );
+
+        if ( mag_ > U( max ) + U( negative_ ) ) return true;
+        //Em complemento de dois, 0 - |min| volta exatamente ao mínimo
+        r_ = static_cast< R >( negative_ ? UR( 0 ) - UR( mag_ ) : UR( mag_ ) );
+        return false;
+    }
+
+    /**
+     * @brief      Potenciação por quadrados sucessivos, interrompida no
+     *             primeiro produto que estoura R.
+     *
+     *             Expoentes negativos seguem a truncagem de pow(): 1 e -1
+     *             preservam o módulo, as demais bases resultam em 0 e a
+     *             base 0 é tratada como overflow (divergente).
+     *
+     * @param[in]  base_  A base
+     * @param[in]  exp_   O expoente
+     * @param[out] r_     O resultado
+     *
+     * @return     True se houve overflow, False caso contrário
+     */
+    template < typename R, typename T >
+    bool pow( T base_, T exp_, R & r_ )
+    {
+        if ( exp_ < 0 )
+        {
+            if ( base_ == 0 ) return true;
+            if ( base_ == 1 or base_ == -1 )
+                return narrow( ( base_ == -1 and exp_ % 2 != 0 ) ? -1 : 1, r_ );
+            r_ = 0;
+            return false;
+        }
+
+        R acc = 1;
+        R b;
+        if ( narrow( base_, b ) ) return exp_ != 0 ? true : ( r_ = 1, false );
+
+        while ( true )
+        {
+            if ( ( exp_ & 1 ) and mul( acc, b, acc ) ) return true;
+            exp_ >>= 1;
+            if ( exp_ == 0 ) break;
+            //Ainda restam bits no expoente: se b*b estoura, o resultado também estoura
+            if ( mul( b, b, b ) ) return true;
+        }
+
+        r_ = acc;
+        return false;
+    }
+
+    /**
+     * @brief      Potenciação módulo 2^n, com n a largura de R
+     *
+     *             Segue arith::pow para expoentes negativos; nos demais casos
+     *             sempre calcula o resultado completo (truncado), sem parar no
+     *             primeiro overflow.
+     *
+     * @return     True apenas para base 0 com expoente negativo
+     */
+    template < typename R, typename T >
+    bool pow_wrap( T base_, T exp_, R & r_ )
+    {
+        if ( exp_ < 0 ) return pow( base_, exp_, r_ );
+
+        using UR = unsigned_of_t< R >;
+        UR acc = 1;
+        UR b = static_cast< UR >( base_ );
+        for ( ; exp_ != 0; exp_ >>= 1, b *= b )
+            if ( exp_ & 1 ) acc *= b;
+
+        r_ = static_cast< R >( acc );
+        return false;
+    }
+}
+
+/**
+ * @brief      Políticas de overflow, escolhidas em tempo de compilação.
+ *
+ *             Cada operação calcula o resultado (truncado) e se houve
+ *             overflow; a política decide o que fazer com ele em resolve().
+ *             Ela só recebe o sinal do resultado exato, o que basta para
+ *             saturar; nas demais políticas esse sinal é código morto.
+ */
+namespace overflow {
+
+    /**
+     * @brief      O overflow é um erro (NUMERIC_OVERFLOW), como no BARES
+     *             original
+     */
+    struct Error
+    {
+        static constexpr bool wraps = false; //<! Usa arith::pow (para no primeiro overflow).
+
+        template < typename R >
+        static constexpr bool resolve( bool overflow_, bool /* negative_ */, R & /* r_ */ )
+        {  return overflow_; }
+    };
+
+    /**
+     * @brief      O resultado é limitado ao mínimo/máximo de R
+     */
+    struct Saturate
+    {
+        static constexpr bool wraps = false;
+
+        template < typename R >
+        static constexpr bool resolve( bool overflow_, bool negative_, R & r_ )
+        {
+            if ( overflow_ )
+                r_ = negative_ ? std::numeric_limits< R >::min() : std::numeric_limits< R >::max();
+            return false;
+        }
+    };
+
+    /**
+     * @brief      O resultado é tomado módulo 2^n, com n a largura de R
+     *             (as builtins já guardam o valor truncado)
+     */
+    struct Wrap
+    {
+        static constexpr bool wraps = true; //<! Usa arith::pow_wrap.
+
+        template < typename R >
+        static constexpr bool resolve( bool /* overflow_ */, bool /* negative_ */, R & /* r_ */ )
+        {  return false; }
+    };
+}
+
+#endif
@@ -13,39 +13,64 @@
 #include <string>    // string
 #include <iomanip>   // std::distance
 #include <cassert>   // assert
-#include <cmath>     // pow
-#include <sstream> // std::stringstream
+#include <type_traits> // std::conditional_t
 
 #include "tokenizer.h"
+#include "arithmetic.h" // arith::add, arith::pow, ...
+#include "arena.h"      // ls::Arena, ls::ArenaAllocator
 
 /**
- * @brief      Classe para bares.
+ * @brief      Códigos de erro do cálculo, comuns a todas as instâncias
  */
-class Bares{
-
+struct EvalCode
+{
     /**
-     * Definição do tipo value_type
+     * @brief      Lista de possíveis erros de sintaxe
      */
-	using value_type = long int;
+    enum code_t {
+        OK = 0,
+        DIVISION_BY_ZERO,
+        NUMERIC_OVERFLOW
+    };
+};
+
+/**
+ * @brief      Classe para bares, com constantes e resultados do tipo Int e
+ *             a política de overflow Policy (overflow::Error, Saturate ou
+ *             Wrap)
+ *
+ *             As instâncias para std::int16_t, std::int32_t, std::int64_t e
+ *             __int128 com cada política estão em bares.cpp; cada uma só tem
+ *             as verificações que a sua política exige.
+ */
+template < typename Int, typename Policy >
+class BasicBares{
 
 	public:
+
+    /**
+     * Definição do tipo value_type: os operandos são promovidos para long,
+     * se for mais largo que Int
+     */
+	using value_type = std::conditional_t< ( sizeof( Int ) < sizeof( long ) ), long int, Int >;
+
+    /**
+     * Token com constantes do tipo Int
+     */
+    using token_type = BasicToken< Int >;
+
+    /**
+     * Lista de Tokens guardada na arena da expressão
+     */
+    using token_list = std::vector< token_type, ls::ArenaAllocator< token_type > >;
     
     /**
      * @brief      Representa o resultado das operações resolvidas
      */
-    struct Result
+    struct Result : EvalCode
     {
-        /**
-         * @brief      Lista de possíveis erros de sintaxe
-         */
-        enum code_t {
-            OK = 0,
-            DIVISION_BY_ZERO,
-            NUMERIC_OVERFLOW
-        };
-
         //=== Membros (público).
-        std::string value_b; //<! Guarda o resultado da operação.
+        value_type value_b; //<! Guarda o resultado da operação.
         code_t type_b;      //<! Código de Error.
 
         /**
@@ -54,7 +79,7 @@ class Bares{
          * @param[in]  v_    valor da operação
          * @param[in]  t_    código de error
          */
-        explicit Result( std::string v_="", code_t t_ = code_t::OK )
+        explicit Result( value_type v_ = 0, code_t t_ = code_t::OK )
             : value_b( v_ )
             , type_b( t_ )
         {/* empty */}     
@@ -62,10 +87,16 @@ class Bares{
 
 	private:
 		
+        /**
+         * Memória de cada expressão (forma posfixa e pilhas), devolvida
+         * em reset()
+         */
+        ls::Arena arena;
+
         /**
          * Vector de expressões
          */
-		std::vector<Token> expression;
+		token_list expression;
 
         /**
          * @brief      Determina se é um operador
@@ -74,7 +105,7 @@ class Bares{
          *
          * @return     True se operador, false caso contrário
          */
-		bool is_operator(Token c);
+		bool is_operator( const token_type & c);
 
         /**
          * @brief      Determina se é operando
@@ -83,25 +114,34 @@ class Bares{
          *
          * @return     True se operando, False caso contrário.
          */
-		bool is_operand( Token c);
+		bool is_operand( const token_type & c);
+
+        /**
+         * @brief      Determina se é uma variável
+         *
+         * @param[in]  c   Token para verificar se é uma variável.
+         *
+         * @return     True se variável, False caso contrário.
+         */
+		bool is_variable( const token_type & c);
 
         /**
          * @brief      Determina se é um parênteses aberto
          *
-         * @param[in]  c     String para se verificar
+         * @param[in]  c     Token para se verificar
          *
          * @return     True se parênteses aberto, False caso contrário.
          */
-		bool is_opening_scope( std::string c);
+		bool is_opening_scope( const token_type & c);
 
         /**
          * @brief      Determina se é um parênteses fechado
          *
-         * @param[in]  c     String para se verificar
+         * @param[in]  c     Token para se verificar
          *
          * @return     True se parênteses fechado, False caso contrário.
          */
-		bool is_closing_scope( std::string c);
+		bool is_closing_scope( const token_type & c);
 
 		/**
          * @brief      Verifica se o op1 tem precedência maior que o op2.
@@ -111,7 +151,7 @@ class Bares{
          *
          * @return     True se tem a precedência maior, False caso contrário.
          */
-        bool has_higher_precedence( std::string op1, std::string op2);
+        bool has_higher_precedence( const token_type & op1, const token_type & op2);
 
 		/**
          * @brief      Verifica se tem associação a direita ( para potências ).
@@ -120,16 +160,28 @@ class Bares{
          *
          * @return     True se é associação a direita, False caso contrário.
          */
-        bool is_right_association(std::string c);
+        bool is_right_association( const token_type & c);
 
 		/**
          * @brief      Pega a precedência.
          *
-         * @param[in]  c     String a ser verificada
+         * @param[in]  c     Token a ser verificado (operador ou "(")
          *
          * @return     A precedência.
          */
-        int get_precedence( std::string c);
+        int get_precedence( const token_type & c);
+
+        /**
+         * @brief      Calcula uma expressão já em notação posfixa, com a
+         *             pilha na arena
+         *
+         * @param[in]  postfix_  Início da forma posfixa
+         * @param[in]  size_     Número de Tokens
+         * @param[in]  vars_     Valor de cada variável (ver evaluate())
+         *
+         * @return     Resultado final da expressão
+         */
+        Result run_postfix( const token_type * postfix_, std::size_t size_, const Int * vars_ );
 
 
 	public:
@@ -139,36 +191,43 @@ class Bares{
         /**
          * @brief      Construtor Default
          */
-        Bares() = default;
+        BasicBares();
 
         /**
          * @brief      Destrói o objeto
          */
-        ~Bares() = default;
+        ~BasicBares() = default;
         
         /**
          * @brief      Construtor Cópial
          *
          * @param[in]  <unnamed>  { parameter_description }
          */
-        Bares( const Bares & ) = delete;
+        BasicBares( const BasicBares & ) = delete;
 
         /**
          * @brief      Atribuição
          *
          * @param[in]  <unnamed>  Cópia a ser feita
          *
-         * @return     Um Bares igual ao repassado
+         * @return     Um BasicBares igual ao repassado
+         */
+        BasicBares & operator=( const BasicBares & ) = delete;
+
+        /**
+         * @brief      Descarta a expressão atual e devolve a memória dela
+         *             à arena, deixando o objeto pronto para a próxima
          */
-        Bares & operator=( const Bares & ) = delete;
+        void reset( void );
       
         /**
          * @brief      Converte a expressão com notação infixa para o
-         *             correspondente em representação posfixa
+         *             correspondente em representação posfixa (a expressão
+         *             anterior é descartada com reset())
          *
          * @param[in]  infix_  Notação Infixa para ser transformada
          */
-		void infix_to_postfix( std::vector<Token> infix_ );
+		void infix_to_postfix( const std::vector< token_type > & infix_ );
 
 		/**
          * @brief      Resolve uma operação
@@ -179,17 +238,46 @@ class Bares{
          *
          * @return     Resultado da operação com a informação de error ou não
          */
-		Bares::Result execute( std::string n1, std::string n2, Token opr);
+		Result execute( value_type n1, value_type n2, const token_type & opr);
         
         /**
          * @brief      Executa a expressão
          *
          * @param[in]  <unnamed>  expressão na forma de Tokens
+         * @param[in]  vars_      Valor de cada variável, pelo índice do Token
+         *                        VARIABLE (só usado se houver variáveis);
+         *                        "-x" é calculado como 0 - x
          *
          * @return     Resultado final da expressão
          */
-		Bares::Result evaluate(std::vector<Token>);
+		Result evaluate( const std::vector< token_type > &, const Int * vars_ = nullptr );
+
+        /**
+         * @brief      Executa uma expressão que já está em notação posfixa
+         *             (uma cópia de postfix(), por exemplo), sem a conversão
+         *
+         * @param[in]  postfix_  Início da forma posfixa (fora deste objeto)
+         * @param[in]  size_     Número de Tokens
+         * @param[in]  vars_     Valor de cada variável (ver evaluate())
+         *
+         * @return     Resultado final da expressão; a expressão atual é
+         *             descartada com reset()
+         */
+        Result evaluate_postfix( const token_type * postfix_, std::size_t size_, const Int * vars_ = nullptr );
+
+        /**
+         * @brief      Recupera a expressão na forma posfixa gerada por
+         *             infix_to_postfix()
+         *
+         * @return     A lista de Tokens em notação posfixa
+         */
+        const token_list & postfix( void ) const;
 };
 
+/**
+ * @brief      O BARES original: constantes de 16 bits e overflow como erro
+ */
+using Bares = BasicBares< std::int16_t, overflow::Error >;
+
 
 #endif
\ No newline at end of file
@@ -0,0 +1,165 @@
+/**
+ * @file batch_eval.h
+ * @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+ * @date 18 Outubro 2026
+ * @brief Arquivo contendo as definições da classe BatchEvaluator, que
+ *        avalia de uma só vez muitas expressões com a mesma estrutura.
+ */
+
+#ifndef _BATCH_EVAL_H_
+#define _BATCH_EVAL_H_
+
+#include <cstdint>       // std::int16_t, std::uint8_t
+#include <string>        // std::string
+#include <vector>        // std::vector
+
+#include "bares.h"    // Bares::token_list, Bares::Result
+#include "bytecode.h" // bc::opcode_t
+
+/**
+ * @brief      Avaliador em lote por formato de expressão.
+ *
+ *             As expressões posfixas são agrupadas pela assinatura (a
+ *             sequência de operandos e operadores, sem os valores). Cada
+ *             grupo é avaliado uma instrução por vez sobre blocos de 64
+ *             expressões, em estrutura de vetores: uma linha de int16 por
+ *             operando e por posição da pilha, processada 16 (+, -, *) ou 8
+ *             (/, %) valores por instrução AVX2, com versão escalar para as
+ *             demais CPUs.
+ *             A potenciação é sempre escalar.
+ *
+ *             O código de erro de cada expressão também é uma linha de
+ *             int16, atualizada pelas máscaras de overflow e de divisão por
+ *             zero; vale o primeiro erro, como em Bares::evaluate.
+ */
+class BatchEvaluator
+{
+    public:
+        //<! apply() processa os valores em grupos deste tamanho.
+        static constexpr std::size_t LANES = 16;
+
+        /**
+         * @brief      Aplica uma instrução binária a n_ expressões de uma vez
+         *             (com AVX2, se a CPU tiver): r_ = a_ op b_, guardando em
+         *             code_ o primeiro erro de cada expressão
+         *
+         * @param[in]  op_    A instrução (ADD, SUB, MUL, DIV, MOD ou POW)
+         * @param[in]  a_     Primeiros operandos
+         * @param[in]  b_     Segundos operandos
+         * @param[out] r_     Resultados (pode ser a_ ou b_)
+         * @param      code_  Código de erro de cada expressão
+         * @param[in]  n_     Número de expressões (múltiplo de LANES)
+         */
+        static void apply( bc::opcode_t op_, const std::int16_t * a_, const std::int16_t * b_,
+                           std::int16_t * r_, std::int16_t * code_, std::size_t n_ );
+
+        /**
+         * @brief      Acrescenta uma expressão ao lote
+         *
+         * @param[in]  postfix_  Expressão em notação posfixa (Bares::postfix())
+         *
+         * @return     O índice do resultado da expressão em run()
+         */
+        std::size_t add( const Bares::token_list & postfix_ );
+
+        /**
+         * @brief      Avalia todas as expressões do lote
+         *
+         * @param[out] results_  Resultado de cada expressão, na ordem de add()
+         */
+        void run( std::vector< Bares::Result > & results_ );
+
+        /**
+         * @brief      Esvazia o lote, mantendo a memória já alocada
+         */
+        void clear( void );
+
+        /**
+         * @brief      Número de expressões no lote
+         */
+        std::size_t size( void ) const
+        {  return count; }
+
+        /**
+         * @brief      Número de formatos distintos no lote
+         */
+        std::size_t groups( void ) const
+        {  return n_groups; }
+
+        //==== Métodos Especiais
+
+        /**
+         * @brief      Construtor Default
+         */
+        BatchEvaluator() = default;
+
+        /**
+         * @brief      Construtor Cópia (removido)
+         */
+        BatchEvaluator( const BatchEvaluator & ) = delete;
+
+        /**
+         * @brief      Atribuição (removida)
+         */
+        BatchEvaluator & operator=( const BatchEvaluator & ) = delete;
+
+    private:
+        /**
+         * @brief      Expressões com a mesma assinatura
+         */
+        struct Group
+        {
+            std::string signature;                //<! Uma bc::opcode_t por Token (PUSH para cada operando).
+            std::uint64_t hash = 0;               //<! Hash da assinatura.
+            std::size_t n_literals = 0;           //<! Operandos por expressão.
+            std::size_t max_depth = 0;            //<! Profundidade máxima da pilha.
+            std::vector< std::int16_t > literals; //<! Operandos, expressão por expressão.
+            std::vector< std::size_t > members;   //<! Índice de cada expressão em run().
+        };
+
+        std::vector< Group > group_list; //<! Grupos (os primeiros n_groups estão em uso).
+        std::size_t n_groups = 0;        //<! Grupos em uso.
+        std::size_t count = 0;           //<! Expressões no lote.
+        std::vector< std::uint32_t > slots; //<! Tabela aberta hash -> grupo + 1 (0 é vazio).
+        std::string key;                 //<! Assinatura da expressão atual.
+
+        //=== Área de trabalho de run() (reaproveitada)
+        std::vector< std::int16_t > columns; //<! Operandos do bloco, uma linha por operando.
+        std::vector< std::int16_t > rows;    //<! Uma linha por posição da pilha.
+        std::vector< std::int16_t > codes;   //<! Código de erro de cada expressão.
+        std::vector< const std::int16_t * > stack; //<! Linha que está em cada posição da pilha.
+
+        /**
+         * @brief      Avalia um grupo
+         *
+         * @param[in]  g_        O grupo
+         * @param[out] results_  Resultados de todo o lote
+         */
+        void run_group( const Group & g_, std::vector< Bares::Result > & results_ );
+
+        /**
+         * @brief      Avalia uma única expressão do grupo, sem SIMD
+         *
+         * @param[in]  g_       O grupo
+         * @param[in]  literals_  Os operandos da expressão
+         *
+         * @return     Resultado da expressão
+         */
+        Bares::Result run_one( const Group & g_, const std::int16_t * literals_ );
+
+        /**
+         * @brief      Encontra o grupo da assinatura em key, criando-o se preciso
+         *
+         * @param[in]  hash_  Hash de key
+         *
+         * @return     O índice do grupo
+         */
+        std::size_t find_group( std::uint64_t hash_ );
+
+        /**
+         * @brief      Dobra a tabela de grupos e reinsere os grupos em uso
+         */
+        void grow_slots( void );
+};
+
+#endif
@@ -0,0 +1,34 @@
+#ifndef _BOUNDED_QUEUE_H_
+#define _BOUNDED_QUEUE_H_
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+namespace ls{
+    template <typename T>
+    class BoundedQueue
+    {
+        private:
+            std::size_t m_capacity;    //<! Número máximo de elementos
+            bool m_closed;             //<! Não aceita mais elementos
+            std::deque<T> m_data;      //<! Area de armazenamento
+            std::mutex m_mutex;
+            std::condition_variable m_not_full;
+            std::condition_variable m_not_empty;
+
+        public:
+            BoundedQueue( std::size_t cap );
+
+            BoundedQueue( const BoundedQueue &) = delete;
+            BoundedQueue & operator=(const BoundedQueue &) = delete;
+
+            bool push( T value );     //bloqueia enquanto cheia; false se fechada
+            bool pop( T & value );    //bloqueia enquanto vazia; false se fechada e vazia
+            void close( void );
+    };
+}
+
+#include "bounded_queue.inl"
+
+#endif
@@ -0,0 +1,53 @@
+/**
+ * @file bounded_queue.inl
+ * @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+ * @date 18 Outubro 2026
+ * @brief Arquivo com a implementação dos métodos da classe ls::BoundedQueue.
+ */
+
+#include "bounded_queue.hpp"
+
+//<! Construtor padrão.
+template <typename T>
+ls::BoundedQueue<T>::BoundedQueue( std::size_t cap )
+    : m_capacity( cap == 0 ? 1 : cap ),
+    m_closed( false )
+    { /*empty*/ }
+
+//<! Insere um elemento, esperando enquanto a fila estiver cheia.
+template <typename T>
+bool ls::BoundedQueue<T>::push( T value ){
+    std::unique_lock<std::mutex> lk( m_mutex );
+    m_not_full.wait( lk, [this]{ return m_closed or m_data.size() < m_capacity; } );
+    if( m_closed ) return false;
+
+    m_data.push_back( std::move( value ) );
+    lk.unlock();
+    m_not_empty.notify_one();
+    return true;
+}
+
+//<! Remove o primeiro elemento, esperando enquanto a fila estiver vazia.
+template <typename T>
+bool ls::BoundedQueue<T>::pop( T & value ){
+    std::unique_lock<std::mutex> lk( m_mutex );
+    m_not_empty.wait( lk, [this]{ return m_closed or not m_data.empty(); } );
+    if( m_data.empty() ) return false;
+
+    value = std::move( m_data.front() );
+    m_data.pop_front();
+    lk.unlock();
+    m_not_full.notify_one();
+    return true;
+}
+
+//<! Fecha a fila: os elementos restantes ainda podem ser retirados.
+template <typename T>
+void ls::BoundedQueue<T>::close(){
+    {
+        std::lock_guard<std::mutex> lk( m_mutex );
+        m_closed = true;
+    }
+    m_not_full.notify_all();
+    m_not_empty.notify_all();
+}
@@ -0,0 +1,117 @@
+/**
+ * @file bytecode.h
+ * @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+ * @date 18 Outubro 2026
+ * @brief Arquivo contendo as definições do programa compilado (bytecode)
+ *        e da máquina virtual que o executa.
+ */
+
+#ifndef _BYTECODE_H_
+#define _BYTECODE_H_
+
+#include <cstdint>  // std::uint8_t, std::int16_t
+#include <cstring>  // std::memcpy
+#include <vector>   // std::vector
+
+#include "token.h"  // struct Token.
+#include "bares.h"  // Bares::Result
+
+namespace bc {
+
+    /**
+     * @brief      Instruções da máquina virtual.
+     *
+     *             PUSH é seguido de 2 bytes com o operando (int16) em linha e
+     *             LOAD de 2 bytes com o índice (uint16) da variável; NEG troca
+     *             o sinal do topo (como 0 - x); as demais instruções
+     *             desempilham dois valores e empilham o resultado.
+     */
+    enum class opcode_t : std::uint8_t
+    {
+        PUSH = 0, //<! Empilha a constante seguinte.
+        ADD,      //<! "+"
+        SUB,      //<! "-"
+        MUL,      //<! "*"
+        DIV,      //<! "/"
+        MOD,      //<! "%"
+        POW,      //<! "^"
+        LOAD,     //<! Empilha a variável de índice seguinte.
+        NEG       //<! Troca o sinal do topo ("-x").
+    };
+
+    /**
+     * @brief      Converte um operador para a instrução correspondente.
+     *
+     * @param[in]  opr_  O operador (diferente de NONE)
+     *
+     * @return     A instrução
+     */
+    opcode_t opcode_of( Token::operator_t opr_ );
+
+    /**
+     * @brief      Expressão compilada: vetor plano de instruções.
+     */
+    struct Program
+    {
+        std::vector< std::uint8_t > code; //<! Instruções com operandos em linha.
+        std::size_t max_depth = 0;        //<! Profundidade máxima da pilha de valores.
+
+        /**
+         * @brief      Esvazia o programa mantendo a memória já alocada.
+         */
+        void clear( void )
+        {
+            code.clear();
+            max_depth = 0;
+        }
+    };
+
+    /**
+     * @brief      Compila a expressão posfixa para bytecode.
+     *
+     * @param[in]  postfix_  Expressão em notação posfixa (Bares::postfix())
+     * @param[out] prog_     Programa gerado
+     */
+    void compile( const Bares::token_list & postfix_, Program & prog_ );
+
+    /**
+     * @brief      Máquina virtual de pilha com valores inteiros nativos.
+     */
+    class VM
+    {
+        public:
+            /**
+             * Definição do tipo value_type
+             */
+            using value_type = Bares::value_type;
+
+            /**
+             * @brief      Executa um programa compilado.
+             *
+             * @param[in]  prog_  O programa
+             * @param[in]  vars_  Valor de cada variável (só usado por LOAD)
+             *
+             * @return     Resultado final da expressão
+             */
+            Bares::Result run( const Program & prog_, const Token::value_type * vars_ = nullptr );
+
+            /**
+             * @brief      Executa um programa que está em outra memória
+             *             (por exemplo, um arquivo mapeado)
+             *
+             * @param[in]  code_       Início das instruções
+             * @param[in]  size_       Bytes das instruções
+             * @param[in]  max_depth_  Profundidade máxima da pilha de valores
+             * @param[in]  vars_       Valor de cada variável (só usado por LOAD)
+             *
+             * @return     Resultado final da expressão
+             */
+            Bares::Result run( const std::uint8_t * code_, std::size_t size_, std::size_t max_depth_,
+                               const Token::value_type * vars_ = nullptr );
+
+        private:
+            std::vector< value_type > stack; //<! Pilha de valores, reaproveitada entre execuções.
+    };
+}
+
+#endif
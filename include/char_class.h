@@ -0,0 +1,84 @@
+/**
+ * @file char_class.h
+ * @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+ * @date 18 Outubro 2026
+ * @brief Arquivo contendo as definições da classificação vetorizada de
+ *        caracteres usada pelo Tokenizer.
+ */
+
+#ifndef _CHAR_CLASS_H_
+#define _CHAR_CLASS_H_
+
+#include <cstdint>     // std::uint64_t
+#include <string_view> // std::string_view
+#include <vector>      // std::vector
+
+/**
+ * @brief      Máscaras de bits com a classe de cada caractere da expressão.
+ *
+ *             O bit i da palavra k corresponde ao caractere 64*k + i. A
+ *             classificação é feita 16 (SSE2) ou 32 (AVX2) bytes por vez,
+ *             com uma versão escalar portátil para as demais arquiteturas.
+ */
+class CharMasks
+{
+    public:
+        /**
+         * @brief      Classifica todos os caracteres da expressão
+         *
+         * @param[in]  s_    A expressão
+         */
+        void classify( std::string_view s_ );
+
+        /**
+         * @brief      Primeira posição a partir de pos_ que não é espaço/tab
+         *
+         * @param[in]  pos_  Posição inicial
+         *
+         * @return     A posição encontrada, ou o tamanho da expressão
+         */
+        std::size_t next_non_ws( std::size_t pos_ ) const
+        {  return next_clear( ws, pos_ ); }
+
+        /**
+         * @brief      Primeira posição a partir de pos_ que não é dígito
+         *
+         * @param[in]  pos_  Posição inicial
+         *
+         * @return     A posição encontrada, ou o tamanho da expressão
+         */
+        std::size_t next_non_digit( std::size_t pos_ ) const
+        {  return next_clear( digit, pos_ ); }
+
+        /**
+         * @brief      Verifica se o caractere na posição é um operador
+         */
+        bool is_operator( std::size_t pos_ ) const
+        {  return test( op, pos_ ); }
+
+        /**
+         * @brief      Verifica se o caractere na posição é um parêntese
+         */
+        bool is_paren( std::size_t pos_ ) const
+        {  return test( paren, pos_ ); }
+
+    private:
+        std::vector< std::uint64_t > digit; //<! "0"-"9"
+        std::vector< std::uint64_t > op;    //<! "+", "-", "*", "/", "%", "^"
+        std::vector< std::uint64_t > paren; //<! "(", ")"
+        std::vector< std::uint64_t > ws;    //<! Espaço e tab
+        std::size_t size = 0;               //<! Número de caracteres classificados.
+
+        /**
+         * @brief      Testa o bit da posição
+         */
+        bool test( const std::vector< std::uint64_t > & m_, std::size_t pos_ ) const
+        {  return pos_ < size and ( ( m_[ pos_ >> 6 ] >> ( pos_ & 63 ) ) & 1u ); }
+
+        /**
+         * @brief      Primeira posição a partir de pos_ cujo bit está zerado
+         */
+        std::size_t next_clear( const std::vector< std::uint64_t > & m_, std::size_t pos_ ) const;
+};
+
+#endif
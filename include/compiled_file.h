@@ -0,0 +1,170 @@
+/**
+ * @file compiled_file.h
+ * @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+ * @date 18 Outubro 2026
+ * @brief Arquivo contendo as definições do formato binário com as
+ *        expressões já compiladas (--compile / --run-compiled).
+ */
+
+#ifndef _COMPILED_FILE_H_
+#define _COMPILED_FILE_H_
+
+#include <cstdint>  // std::uint8_t, std::uint32_t, std::uint64_t
+#include <string>   // std::string
+#include <vector>   // std::vector
+
+#include "bytecode.h"    // bc::Program
+#include "mapped_file.h" // MappedFile
+#include "tokenizer.h"   // Tokenizer::Result
+
+namespace bc {
+
+    /**
+     * @brief      Cabeçalho do arquivo compilado.
+     *
+     *             O arquivo é: cabeçalho, tabela com uma FileEntry por linha
+     *             da entrada e a área de código com os programas (bytecode
+     *             de bc::compile) concatenados. Tudo na ordem de bytes da
+     *             máquina; o checksum cobre a tabela e a área de código.
+     */
+    struct FileHeader
+    {
+        char magic[8];            //<! FILE_MAGIC.
+        std::uint32_t version;    //<! FILE_VERSION.
+        std::uint32_t value_bytes; //<! Bytes de cada operando em linha (sizeof( std::int16_t )).
+        std::uint64_t count;      //<! Número de linhas (entradas da tabela).
+        std::uint64_t code_size;  //<! Bytes da área de código.
+        std::uint64_t checksum;   //<! Hash da tabela e da área de código.
+    };
+
+    /**
+     * @brief      Uma linha da entrada: programa ou erro de parsing
+     */
+    struct FileEntry
+    {
+        //=== Tipo de entrada
+        enum kind_t : std::uint8_t
+        {
+            PROGRAM = 0, //<! Expressão válida: offset, size e max_depth.
+            PARSE_ERROR  //<! Erro do Tokenizer: code e column.
+        };
+
+        std::uint64_t offset;    //<! Início do programa na área de código.
+        std::uint32_t size;      //<! Bytes do programa.
+        std::uint32_t column;    //<! Coluna do erro.
+        std::uint32_t max_depth; //<! Profundidade máxima da pilha do programa.
+        std::uint8_t kind;       //<! Um kind_t.
+        std::uint8_t code;       //<! Tokenizer::Result::code_t.
+        std::uint16_t reserved;  //<! Sempre 0.
+    };
+
+    static_assert( sizeof( FileHeader ) == 40, "FileHeader deve ter 40 bytes" );
+    static_assert( sizeof( FileEntry ) == 24, "FileEntry deve ter 24 bytes" );
+    static_assert( sizeof( FileEntry ) % 8 == 0, "o checksum lê a tabela em palavras de 64 bits" );
+
+    //<! Identificação do arquivo.
+    constexpr char FILE_MAGIC[8] = { 'B', 'A', 'R', 'E', 'S', 'B', 'C', '\0' };
+    //<! Versão do formato; muda sempre que o bytecode ou o layout mudarem.
+    constexpr std::uint32_t FILE_VERSION = 2;
+
+    /**
+     * @brief      Monta um arquivo compilado em memória e o grava.
+     */
+    class FileWriter
+    {
+        public:
+            /**
+             * @brief      Acrescenta uma expressão válida
+             *
+             * @param[in]  prog_  O programa compilado
+             */
+            void add( const Program & prog_ );
+
+            /**
+             * @brief      Acrescenta uma linha com erro de parsing
+             *
+             * @param[in]  result_  Resultado do Tokenizer (diferente de OK)
+             */
+            void add_error( const Tokenizer::Result & result_ );
+
+            /**
+             * @brief      Grava o arquivo
+             *
+             * @param[in]  path_  Caminho do arquivo
+             *
+             * @throw      std::runtime_error se a gravação falhar
+             */
+            void save( const std::string & path_ ) const;
+
+            /**
+             * @brief      Número de linhas
+             */
+            std::size_t size( void ) const
+            {  return entries.size(); }
+
+        private:
+            std::vector< FileEntry > entries;  //<! Tabela.
+            std::vector< std::uint8_t > code;  //<! Área de código.
+    };
+
+    /**
+     * @brief      Arquivo compilado mapeado em memória (somente leitura).
+     *
+     *             A abertura confere o cabeçalho, os tamanhos, o checksum e
+     *             cada entrada (tipo, código de erro e o bytecode de cada
+     *             programa, com a pilha simulada); depois disso as entradas
+     *             e os programas são lidos direto do mapeamento, sem nenhuma
+     *             conversão nem verificação.
+     */
+    class CompiledFile
+    {
+        public:
+            /**
+             * @brief      Mapeia e confere o arquivo
+             *
+             * @param[in]  path_  Caminho do arquivo
+             *
+             * @throw      std::runtime_error se o arquivo não puder ser
+             *             mapeado ou não for um arquivo compilado válido
+             */
+            explicit CompiledFile( const std::string & path_ );
+
+            /**
+             * @brief      Número de linhas
+             */
+            std::size_t size( void ) const
+            {  return count; }
+
+            /**
+             * @brief      A i-ésima entrada da tabela
+             */
+            const FileEntry & entry( std::size_t i_ ) const
+            {  return table[ i_ ]; }
+
+            /**
+             * @brief      O programa de uma entrada PROGRAM
+             */
+            const std::uint8_t * program( const FileEntry & e_ ) const
+            {  return code + e_.offset; }
+
+            //==== Métodos Especiais
+
+            /**
+             * @brief      Construtor Cópia (removido)
+             */
+            CompiledFile( const CompiledFile & ) = delete;
+
+            /**
+             * @brief      Atribuição (removida)
+             */
+            CompiledFile & operator=( const CompiledFile & ) = delete;
+
+        private:
+            MappedFile file;              //<! O mapeamento.
+            std::size_t count;            //<! Número de linhas.
+            const FileEntry * table;      //<! Tabela, dentro do mapeamento.
+            const std::uint8_t * code;    //<! Área de código, dentro do mapeamento.
+    };
+}
+
+#endif
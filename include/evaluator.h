@@ -0,0 +1,130 @@
+/**
+ * @file evaluator.h
+ * @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+ * @date 18 Outubro 2026
+ * @brief Arquivo contendo as definições da classe Evaluator, que avalia
+ *        uma linha de entrada e escreve a saída correspondente.
+ */
+
+#ifndef _EVALUATOR_H_
+#define _EVALUATOR_H_
+
+#include <iostream> // std::ostream
+#include <string>   // std::string
+#include <string_view> // std::string_view
+
+#include "tokenizer.h"
+#include "bares.h"
+#include "bytecode.h"
+#include "fused_evaluator.h"
+#include "jit.h"
+#include "output_writer.h"
+#include "result_cache.h"
+#include "stats.h"
+
+/**
+ * @brief      Imprime menssagens de erro do Bares
+ *
+ * @param      os      Fluxo de saída
+ * @param[in]  result  O Resultado do bares
+ */
+void print_msg_bares( std::ostream & os, const Bares::Result & result );
+
+/**
+ * @brief      Imprime menssagens de erro do Tokenizer
+ *
+ * @param      os      Fluxo de saída
+ * @param[in]  result  O resultado do Tokenizer
+ */
+void print_msg( std::ostream & os, const Tokenizer::Result & result );
+
+/**
+ * @brief      Opções de avaliação escolhidas na linha de comando
+ */
+struct EvalOptions
+{
+    bool fused = false;          //<! Avalia durante o parsing (FusedEvaluator).
+    std::size_t cache_bytes = 0; //<! Limite do cache de resultados (0 desliga).
+    bool jit = false;            //<! Compila os formatos mais frequentes (jit::Cache).
+    OutputWriter::format_t output = OutputWriter::format_t::TEXT; //<! Formato da saída.
+    stats::Registry * stats = nullptr; //<! Onde registrar as estatísticas (nullptr desliga).
+};
+
+/**
+ * @brief      Agrupa o Tokenizer e o compilador/VM usados para avaliar
+ *             uma linha. Cada thread deve possuir a sua instância.
+ */
+class Evaluator
+{
+    public:
+        /**
+         * @brief      Cria o avaliador
+         *
+         * @param[in]  options_  Opções de avaliação
+         */
+        explicit Evaluator( const EvalOptions & options_ = EvalOptions() );
+
+        /**
+         * @brief      Avalia uma expressão e escreve o resultado (ou o erro)
+         *
+         * @param[in]  expr_  A expressão
+         * @param      out_   Destino da saída (no seu formato)
+         */
+        void eval( std::string_view expr_, OutputWriter & out_ );
+
+        /**
+         * @brief      Avalia uma expressão e escreve o resultado (ou a
+         *             mensagem de erro) em texto, seguido de quebra de linha.
+         *
+         * @param[in]  expr_  A expressão
+         * @param      os_    Fluxo de saída
+         */
+        void eval( std::string_view expr_, std::ostream & os_ );
+
+        /**
+         * @brief      Avalia uma lista de Tokens já validada pelo Tokenizer
+         *             e escreve o resultado
+         *
+         * @param[in]  tokens_  Os Tokens da expressão (notação infixa)
+         * @param      out_     Destino da saída (no seu formato)
+         */
+        void eval_tokens( const std::vector< Token > & tokens_, OutputWriter & out_ );
+
+        /**
+         * @brief      Acesso ao cache de resultados (contadores de acerto)
+         */
+        const ResultCache & result_cache( void ) const
+        {  return cache; }
+
+        //==== Métodos Especiais
+
+        /**
+         * @brief      Destrói o objeto
+         */
+        ~Evaluator() = default;
+
+        /**
+         * @brief      Construtor Cópia (removido)
+         */
+        Evaluator( const Evaluator & ) = delete;
+
+        /**
+         * @brief      Atribuição (removida)
+         */
+        Evaluator & operator=( const Evaluator & ) = delete;
+
+    private:
+        EvalOptions options; //<! Opções de avaliação.
+        Tokenizer parser;   //<! O parser da linha.
+        FusedEvaluator fused; //<! Avaliador de passada única (opção fused).
+        Bares bares;         //<! Conversão para posfixa (reaproveitada a cada linha).
+        bc::Program program; //<! Expressão compilada (reaproveitada a cada linha).
+        bc::VM vm;           //<! Máquina virtual que executa o programa.
+        jit::Cache jit_cache; //<! Código nativo dos formatos frequentes (opção jit).
+        ResultCache cache;   //<! Resultados já calculados (opção cache_bytes).
+        std::string key;     //<! Chave da linha atual (reaproveitada a cada linha).
+        OutputWriter text;   //<! Saída em texto de eval() com std::ostream.
+        stats::Counters * counters; //<! Estatísticas desta instância (ou nullptr).
+};
+
+#endif
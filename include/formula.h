@@ -0,0 +1,120 @@
+/**
+ * @file formula.h
+ * @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+ * @date 18 Outubro 2026
+ * @brief Arquivo contendo as definições da classe Formula, uma expressão
+ *        com variáveis compilada uma vez e avaliada sobre muitas linhas de
+ *        valores.
+ */
+
+#ifndef _FORMULA_H_
+#define _FORMULA_H_
+
+#include <cstdint>     // std::int16_t, std::uint8_t
+#include <string>      // std::string
+#include <string_view> // std::string_view
+#include <vector>      // std::vector
+
+#include "tokenizer.h" // Tokenizer
+#include "bares.h"     // Bares
+#include "bytecode.h"  // bc::Program
+
+/**
+ * @brief      Expressão com variáveis ("a * x + b"), compilada uma vez.
+ *
+ *             compile() faz o parsing (com Tokenizer::allow_variables) e a
+ *             conversão para posfixa uma única vez e gera o bytecode, em que
+ *             cada variável é uma instrução LOAD. evaluate() recebe os
+ *             valores em colunas, uma por variável, e executa o programa
+ *             uma instrução por vez sobre blocos de linhas, com as mesmas
+ *             operações vetorizadas de BatchEvaluator: as colunas são lidas
+ *             direto da memória de quem chama, sem cópias nem texto.
+ *
+ *             O resultado de cada linha é o mesmo de Bares::evaluate() com
+ *             os valores da linha; vale o primeiro erro, e "-x" é 0 - x.
+ */
+class Formula
+{
+    public:
+        //=== Alias
+        using value_type = Token::value_type; //<! Tipo dos valores das variáveis e dos resultados.
+
+        //<! Retorno de slot() para um nome que não está na fórmula.
+        static constexpr std::size_t NONE = ~std::size_t( 0 );
+
+        /**
+         * @brief      Compila a expressão
+         *
+         * @param[in]  expr_  A expressão, com nomes de variáveis
+         *
+         * @return     O resultado do parsing; só uma fórmula OK pode ser
+         *             avaliada
+         */
+        Tokenizer::Result compile( std::string_view expr_ );
+
+        /**
+         * @brief      Nomes das variáveis, na ordem das colunas de evaluate()
+         */
+        const std::vector< std::string > & variables( void ) const
+        {  return names; }
+
+        /**
+         * @brief      Posição de uma variável em variables()
+         *
+         * @param[in]  name_  O nome
+         *
+         * @return     A posição, ou NONE se a fórmula não usa o nome
+         */
+        std::size_t slot( std::string_view name_ ) const;
+
+        /**
+         * @brief      Avalia a fórmula sobre rows_ linhas de valores
+         *
+         * @param[in]  columns_  Uma coluna por variável, na ordem de
+         *                       variables(), cada uma com rows_ valores
+         * @param[in]  rows_     Número de linhas
+         * @param[out] values_   Resultado de cada linha (0 se houve erro)
+         * @param[out] codes_    Código de erro de cada linha
+         *                       (Bares::Result::code_t)
+         */
+        void evaluate( const std::vector< const value_type * > & columns_, std::size_t rows_,
+                       std::vector< value_type > & values_, std::vector< std::uint8_t > & codes_ );
+
+        /**
+         * @brief      O programa compilado
+         */
+        const bc::Program & program( void ) const
+        {  return prog; }
+
+        //==== Métodos Especiais
+
+        /**
+         * @brief      Construtor Default
+         */
+        Formula() = default;
+
+        /**
+         * @brief      Construtor Cópia (removido)
+         */
+        Formula( const Formula & ) = delete;
+
+        /**
+         * @brief      Atribuição (removida)
+         */
+        Formula & operator=( const Formula & ) = delete;
+
+    private:
+        Tokenizer parser;                 //<! Parser, com variáveis.
+        Bares bares;                      //<! Conversão para posfixa.
+        bc::Program prog;                 //<! Programa (vazio se a compilação falhou).
+        std::vector< std::string > names; //<! Variáveis, por índice.
+
+        //=== Área de trabalho de evaluate() (reaproveitada)
+        std::vector< std::int16_t > constants; //<! Uma linha por PUSH, com a constante repetida.
+        std::vector< std::int16_t > rows;      //<! Uma linha por posição da pilha.
+        std::vector< std::int16_t > zeros;     //<! Linha de zeros (NEG é 0 - x).
+        std::vector< std::int16_t > codes;     //<! Código de erro de cada linha do bloco.
+        std::vector< const std::int16_t * > stack; //<! Linha que está em cada posição da pilha.
+};
+
+#endif
@@ -0,0 +1,121 @@
+/**
+ * @file fused_evaluator.h
+ * @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+ * @date 18 Outubro 2026
+ * @brief Arquivo contendo as definições da classe FusedEvaluator, que
+ *        avalia a expressão durante o parsing, em uma única passada.
+ */
+
+#ifndef _FUSED_EVALUATOR_H_
+#define _FUSED_EVALUATOR_H_
+
+#include <string_view> // std::string_view
+
+#include "tokenizer.h"
+#include "bares.h"
+#include "char_class.h"
+
+/**
+ * @brief      Avaliador de passada única por precedence climbing.
+ *
+ *             Reconhece a mesma gramática do Tokenizer e calcula o valor ao
+ *             mesmo tempo, sem lista de Tokens nem forma posfixa. Os erros
+ *             de sintaxe (com as mesmas colunas do Tokenizer) têm prioridade
+ *             sobre os erros de cálculo; entre estes, vale o primeiro na
+ *             ordem em que Bares::evaluate os encontraria.
+ */
+class FusedEvaluator
+{
+    public:
+        /**
+         * @brief      Faz o parsing e avalia a expressão
+         *
+         * @param[in]  e_       A expressão
+         * @param[out] value_   Resultado do cálculo (válido se o retorno for OK)
+         *
+         * @return     O resultado do parsing, igual ao de Tokenizer::parse()
+         */
+        Tokenizer::Result run( std::string_view e_, Bares::Result & value_ );
+
+        //==== Métodos Especiais
+
+        /**
+         * @brief      Construtor Default
+         */
+        FusedEvaluator() = default;
+
+        /**
+         * @brief      Construtor Cópia (removido)
+         */
+        FusedEvaluator( const FusedEvaluator & ) = delete;
+
+        /**
+         * @brief      Atribuição (removida)
+         */
+        FusedEvaluator & operator=( const FusedEvaluator & ) = delete;
+
+    private:
+        //=== Aliases
+        using Result = Tokenizer::Result;
+        using value_type = Bares::value_type;
+
+        std::string_view expr; //<! A expressão.
+        std::size_t pos = 0;   //<! Posição do caractere atual.
+        CharMasks masks;       //<! Classe de cada caractere da expressão.
+        Bares bares;           //<! Usado apenas para Bares::execute.
+        Bares::Result::code_t error = Bares::Result::OK; //<! Primeiro erro de cálculo.
+
+        /**
+         * @brief      Ignora qualquer espaço/Tab
+         */
+        void skip_ws( void );
+
+        /**
+         * @brief      Verifica se chegamos ao final da expressão
+         */
+        bool end_input( void ) const;
+
+        /**
+         * @brief      Aplica um operador, a menos que já tenha havido erro
+         *
+         * @param[in]  op_   O operador
+         * @param      lhs_  Operando esquerdo; recebe o resultado
+         * @param[in]  rhs_  Operando direito
+         */
+        void apply( Token::operator_t op_, value_type & lhs_, value_type rhs_ );
+
+        //=== NTS methods.
+
+        /**
+         * @brief      <expr> := <term>,{ <operador>,<term> }
+         *
+         * @param[out] value_  Valor da expressão
+         */
+        Result expression( value_type & value_ );
+
+        /**
+         * @brief      Consome operadores com precedência mínima min_prec_ e
+         *             os termos que os seguem, acumulando em lhs_
+         *
+         * @param      lhs_       Valor acumulado à esquerda
+         * @param[in]  min_prec_  Precedência mínima aceita
+         */
+        Result climb( value_type & lhs_, int min_prec_ );
+
+        /**
+         * @brief      <term> := "(",<expr>,")" | <integer>
+         *
+         * @param[out] value_  Valor do termo
+         */
+        Result term( value_type & value_ );
+
+        /**
+         * @brief      <integer> := 0 | ["-"],<natural_number>
+         *
+         * @param[out] value_     Módulo do inteiro (saturado se for grande demais)
+         * @param[out] negative_  Se o inteiro é negativo
+         */
+        Result integer( Tokenizer::input_int_type & value_, bool & negative_ );
+};
+
+#endif
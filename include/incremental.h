@@ -0,0 +1,186 @@
+/**
+ * @file incremental.h
+ * @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+ * @date 18 Outubro 2026
+ * @brief Arquivo contendo as definições da classe IncrementalEvaluator, que
+ *        reavalia uma expressão longa depois de pequenas edições.
+ */
+
+#ifndef _INCREMENTAL_H_
+#define _INCREMENTAL_H_
+
+#include <cstdint>     // std::uint32_t
+#include <string>      // std::string
+#include <string_view> // std::string_view
+#include <vector>      // std::vector
+
+#include "tokenizer.h"
+#include "bares.h"
+
+/**
+ * @brief      Avaliador incremental sobre a árvore sintática da expressão.
+ *
+ *             Cada nó guarda o seu trecho do texto (deslocamento relativo ao
+ *             pai e comprimento) e o seu valor já calculado. Uma edição é
+ *             localizada descendo da raiz até o menor átomo (constante ou
+ *             grupo entre parênteses) que contém o trecho alterado; apenas o
+ *             texto desse átomo é analisado de novo e, se ele continuar
+ *             sendo um único átomo, a nova subárvore toma o lugar da antiga.
+ *             Depois disso só os ancestrais têm o comprimento, o deslocamento
+ *             do irmão à direita e o valor atualizados: o custo é o da
+ *             profundidade do átomo, e não o do tamanho da expressão.
+ *
+ *             Qualquer outro caso (edição sobre um operador fora de
+ *             parênteses, átomo que deixou de ser átomo, erro de sintaxe)
+ *             refaz o parsing completo, de modo que o resultado é sempre
+ *             igual ao de Tokenizer::parse() + Bares::evaluate() sobre o
+ *             texto editado. A árvore segue as mesmas regras de precedência
+ *             e associatividade de Bares::infix_to_postfix().
+ */
+class IncrementalEvaluator
+{
+    public:
+        /**
+         * @brief      Contadores de trabalho (para medir e depurar)
+         */
+        struct Counters
+        {
+            std::size_t edits = 0;         //<! Edições aplicadas.
+            std::size_t full_parses = 0;   //<! Parsings completos (load() e recuperações).
+            std::size_t reparsed_bytes = 0; //<! Bytes analisados de novo nas edições locais.
+            std::size_t updated_nodes = 0; //<! Ancestrais atualizados nas edições locais.
+        };
+
+        /**
+         * @brief      Analisa e avalia a expressão inteira
+         *
+         * @param[in]  expr_  A expressão
+         *
+         * @return     O resultado do parsing, igual ao de Tokenizer::parse()
+         */
+        Tokenizer::Result load( std::string_view expr_ );
+
+        /**
+         * @brief      Substitui erase_ bytes a partir de pos_ por insert_ e
+         *             reavalia a expressão
+         *
+         * @param[in]  pos_     Posição (a partir de 0) no texto atual
+         * @param[in]  erase_   Bytes removidos (limitado ao fim do texto)
+         * @param[in]  insert_  Texto inserido
+         *
+         * @return     O resultado do parsing do texto editado
+         */
+        Tokenizer::Result edit( std::size_t pos_, std::size_t erase_, std::string_view insert_ );
+
+        /**
+         * @brief      Resultado do cálculo (válido se o último parsing foi OK)
+         */
+        Bares::Result value( void ) const;
+
+        /**
+         * @brief      O texto atual
+         */
+        const std::string & text( void ) const
+        {  return expr; }
+
+        /**
+         * @brief      Contadores de trabalho
+         */
+        const Counters & counters( void ) const
+        {  return work; }
+
+        //==== Métodos Especiais
+
+        /**
+         * @brief      Construtor Default
+         */
+        IncrementalEvaluator() = default;
+
+        /**
+         * @brief      Construtor Cópia (removido)
+         */
+        IncrementalEvaluator( const IncrementalEvaluator & ) = delete;
+
+        /**
+         * @brief      Atribuição (removida)
+         */
+        IncrementalEvaluator & operator=( const IncrementalEvaluator & ) = delete;
+
+    private:
+        //=== Constantes
+        static constexpr std::uint32_t NONE = ~std::uint32_t( 0 ); //<! Índice nulo.
+
+        /**
+         * @brief      Nó da árvore
+         */
+        struct Node
+        {
+            //=== Tipos de nó
+            enum kind_t : std::uint8_t
+            {
+                LITERAL = 0, //<! Constante (com os "-" que a precedem).
+                BINARY,      //<! Operação entre left e right.
+                GROUP        //<! "(" left ")".
+            };
+
+            std::uint32_t parent = NONE; //<! Pai (NONE na raiz).
+            std::uint32_t left = NONE;   //<! Operando esquerdo ou conteúdo do grupo.
+            std::uint32_t right = NONE;  //<! Operando direito.
+            std::size_t offset = 0;      //<! Início relativo ao início do pai (absoluto na raiz).
+            std::size_t length = 0;      //<! Comprimento do trecho.
+            kind_t kind = LITERAL;       //<! Tipo do nó.
+            TokenKinds::operator_t op = TokenKinds::operator_t::NONE; //<! Operador (BINARY).
+            Bares::Result result;        //<! Valor da subárvore.
+        };
+
+        std::string expr;                //<! Texto atual.
+        std::vector< Node > nodes;       //<! Todos os nós.
+        std::vector< std::uint32_t > free_nodes; //<! Nós livres para reaproveitar.
+        std::uint32_t root = NONE;       //<! Raiz (NONE se o último parsing falhou).
+        Tokenizer parser;                //<! Parser do texto (inteiro ou de um átomo).
+        Bares bares;                     //<! Usado apenas por Bares::execute().
+        Counters work;                   //<! Contadores de trabalho.
+
+        //=== Área de trabalho de build() (reaproveitada)
+        std::vector< std::uint32_t > operands; //<! Pilha de subárvores.
+        std::vector< Token > operators;        //<! Pilha de operadores e "(".
+
+        /**
+         * @brief      Faz o parsing completo de expr e reconstrói a árvore
+         *
+         * @return     O resultado do parsing
+         */
+        Tokenizer::Result full_parse( void );
+
+        /**
+         * @brief      Constrói a árvore dos Tokens do parser
+         *
+         * @param[in]  text_  Texto analisado pelo parser
+         * @param[in]  base_  Posição de text_ dentro de expr
+         *
+         * @return     A raiz, com deslocamento absoluto
+         */
+        std::uint32_t build( std::string_view text_, std::size_t base_ );
+
+        /**
+         * @brief      Junta o operador do topo com as duas últimas subárvores
+         */
+        void reduce( void );
+
+        /**
+         * @brief      Cria um nó (reaproveitando um livre)
+         */
+        std::uint32_t make_node( Node::kind_t kind_ );
+
+        /**
+         * @brief      Devolve uma subárvore à lista de nós livres
+         */
+        void release( std::uint32_t n_ );
+
+        /**
+         * @brief      Recalcula o valor de um nó a partir dos filhos
+         */
+        void combine( Node & n_ );
+};
+
+#endif
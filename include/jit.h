@@ -0,0 +1,183 @@
+/**
+ * @file jit.h
+ * @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+ * @date 18 Outubro 2026
+ * @brief Arquivo contendo as definições do compilador JIT (x86-64) dos
+ *        formatos de expressão mais frequentes.
+ */
+
+#ifndef _JIT_H_
+#define _JIT_H_
+
+#include <cstdint>       // std::int16_t, std::uint8_t, std::uint64_t
+#include <unordered_map> // std::unordered_map
+#include <vector>        // std::vector
+
+#include "bares.h"    // Bares::token_list, Bares::Result
+
+namespace jit {
+
+    /**
+     * @brief      Código gerado para um formato de expressão.
+     *
+     *             Recebe os operandos da expressão (na ordem da forma posfixa)
+     *             e devolve o código de Bares::Result; o valor só é escrito
+     *             quando o código é OK.
+     */
+    using function_t = int (*)( const std::int16_t * literals_, std::int16_t * value_ );
+
+    /**
+     * @brief      Verifica se há gerador de código para esta plataforma
+     *
+     * @return     True em x86-64 com mmap, False caso contrário
+     */
+    bool supported( void );
+
+    /**
+     * @brief      Memória executável onde as funções são gravadas.
+     *
+     *             As páginas ficam somente leitura/execução e só viram
+     *             graváveis durante a cópia de uma nova função (W^X). Cada
+     *             instância deve ser usada por uma única thread.
+     */
+    class CodeBuffer
+    {
+        public:
+            /**
+             * @brief      Copia o código para a memória executável
+             *
+             * @param[in]  code_  O código de máquina
+             *
+             * @return     O endereço da função, ou nullptr se mmap/mprotect falhar
+             */
+            const void * add( const std::vector< std::uint8_t > & code_ );
+
+            /**
+             * @brief      Bytes de memória executável reservados
+             */
+            std::size_t capacity( void ) const;
+
+            //==== Métodos Especiais
+
+            /**
+             * @brief      Construtor Default
+             */
+            CodeBuffer() = default;
+
+            /**
+             * @brief      Desfaz todos os mapeamentos
+             */
+            ~CodeBuffer();
+
+            /**
+             * @brief      Construtor Cópia (removido)
+             */
+            CodeBuffer( const CodeBuffer & ) = delete;
+
+            /**
+             * @brief      Atribuição (removida)
+             */
+            CodeBuffer & operator=( const CodeBuffer & ) = delete;
+
+        private:
+            /**
+             * @brief      Uma região mapeada
+             */
+            struct Chunk
+            {
+                std::uint8_t * base; //<! Início da região.
+                std::size_t size;    //<! Tamanho (múltiplo da página).
+                std::size_t used;    //<! Bytes já ocupados.
+            };
+
+            std::vector< Chunk > chunks; //<! Regiões mapeadas, a última é a atual.
+    };
+
+    /**
+     * @brief      Cache de funções compiladas por formato de expressão.
+     *
+     *             O formato é a sequência de operandos e operadores da forma
+     *             posfixa, sem os valores, que são passados como parâmetros.
+     *             Cada expressão é identificada por um hash de 64 bits do seu
+     *             formato; os formatos ainda frios só ocupam um contador em
+     *             uma tabela de tamanho fixo (um formato novo toma o lugar
+     *             do que estava no mesmo contador). Um formato é compilado
+     *             depois de visto threshold vezes seguidas no seu contador e
+     *             só então entra no mapa, com o tipo e o operador de cada
+     *             Token, conferidos a cada execução (colisões do hash ficam
+     *             com o interpretador). Formatos com "^" ou variáveis (ou
+     *             longos demais) e plataformas sem suporte ficam com o
+     *             interpretador (run() devolve false). Cada thread deve
+     *             possuir a sua instância.
+     */
+    class Cache
+    {
+        public:
+            /**
+             * @brief      Cria o cache
+             *
+             * @param[in]  threshold_      Execuções de um formato antes de compilá-lo
+             * @param[in]  max_functions_  Número máximo de formatos compilados
+             */
+            explicit Cache( std::size_t threshold_ = 16, std::size_t max_functions_ = 4096 );
+
+            /**
+             * @brief      Avalia a expressão com o código compilado do seu formato
+             *
+             * @param[in]  postfix_  Expressão em notação posfixa (Bares::postfix())
+             * @param[out] result_   Resultado (válido se o retorno for true)
+             *
+             * @return     True se a expressão foi avaliada, False se o chamador
+             *             deve usar o interpretador
+             */
+            bool run( const Bares::token_list & postfix_, Bares::Result & result_ );
+
+            /**
+             * @brief      Número de formatos compilados
+             */
+            std::size_t compiled( void ) const
+            {  return n_compiled; }
+
+            //==== Métodos Especiais
+
+            /**
+             * @brief      Construtor Cópia (removido)
+             */
+            Cache( const Cache & ) = delete;
+
+            /**
+             * @brief      Atribuição (removida)
+             */
+            Cache & operator=( const Cache & ) = delete;
+
+        private:
+            /**
+             * @brief      Um formato quente
+             */
+            struct Entry
+            {
+                std::vector< std::uint8_t > signature; //<! Tipo e operador de cada Token do formato.
+                function_t fn = nullptr;    //<! Código compilado (nullptr: sempre usa o interpretador).
+            };
+
+            /**
+             * @brief      Contador de um formato ainda frio
+             */
+            struct Counter
+            {
+                std::uint64_t hash = 0;     //<! Hash do formato.
+                std::size_t hits = 0;       //<! Execuções seguidas até agora.
+            };
+
+            std::size_t threshold;     //<! Execuções antes de compilar.
+            std::size_t max_functions; //<! Limite de formatos compilados.
+            std::size_t n_compiled = 0; //<! Formatos compilados.
+            CodeBuffer buffer;         //<! Memória executável.
+            std::unordered_map< std::uint64_t, Entry > entries; //<! Hash -> formato quente.
+            std::vector< Counter > counters;      //<! Formatos frios, indexados pelo hash.
+            std::vector< std::int16_t > literals; //<! Operandos da expressão atual.
+            std::vector< std::uint8_t > code;     //<! Código em construção.
+    };
+}
+
+#endif
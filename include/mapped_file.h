@@ -0,0 +1,60 @@
+/**
+ * @file mapped_file.h
+ * @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+ * @date 18 Outubro 2026
+ * @brief Arquivo contendo as definições da classe MappedFile, um arquivo
+ *        somente leitura mapeado em memória.
+ */
+
+#ifndef _MAPPED_FILE_H_
+#define _MAPPED_FILE_H_
+
+#include <string>      // std::string
+#include <string_view> // std::string_view
+
+/**
+ * @brief      Mapeia um arquivo inteiro com mmap (somente leitura).
+ *
+ *             O conteúdo vem direto do page cache: as linhas podem ser
+ *             entregues ao parser como std::string_view, sem cópias.
+ */
+class MappedFile
+{
+    public:
+        /**
+         * @brief      Abre e mapeia o arquivo
+         *
+         * @param[in]  path_  Caminho do arquivo
+         *
+         * @throw      std::runtime_error se o arquivo não puder ser mapeado
+         */
+        explicit MappedFile( const std::string & path_ );
+
+        /**
+         * @brief      Desfaz o mapeamento
+         */
+        ~MappedFile();
+
+        /**
+         * @brief      Construtor Cópia (removido)
+         */
+        MappedFile( const MappedFile & ) = delete;
+
+        /**
+         * @brief      Atribuição (removida)
+         */
+        MappedFile & operator=( const MappedFile & ) = delete;
+
+        /**
+         * @brief      Conteúdo do arquivo
+         *
+         * @return     Uma visão de todo o conteúdo mapeado
+         */
+        std::string_view view( void ) const;
+
+    private:
+        const char * m_data; //<! Início do mapeamento (nullptr se vazio).
+        std::size_t m_size;  //<! Tamanho do arquivo.
+};
+
+#endif
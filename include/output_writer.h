@@ -0,0 +1,184 @@
+/**
+ * @file output_writer.h
+ * @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+ * @date 18 Outubro 2026
+ * @brief Arquivo contendo as definições da classe OutputWriter, que formata
+ *        os resultados em um buffer reaproveitado.
+ */
+
+#ifndef _OUTPUT_WRITER_H_
+#define _OUTPUT_WRITER_H_
+
+#include <cstdint>     // std::int64_t, std::uint32_t, std::uint8_t
+#include <string>      // std::string
+#include <string_view> // std::string_view
+#include <type_traits> // std::is_trivially_copyable
+
+#include "tokenizer.h"
+#include "bares.h"
+
+/**
+ * @brief      Registro de tamanho fixo do formato binário (ordem de bytes
+ *             da máquina).
+ */
+struct OutputRecord
+{
+    //=== Tipo de registro
+    enum kind_t : std::uint8_t
+    {
+        VALUE = 0,    //<! Expressão calculada: value é o resultado.
+        PARSE_ERROR,  //<! Erro do Tokenizer: code e column.
+        EVAL_ERROR    //<! Erro do cálculo: code.
+    };
+
+    std::int64_t value;    //<! Resultado (0 nos erros).
+    std::uint32_t column;  //<! Coluna do erro do Tokenizer (0 nos demais).
+    std::uint8_t kind;     //<! Um kind_t.
+    std::uint8_t code;     //<! Tokenizer::Result::code_t ou Bares::Result::code_t.
+    std::uint16_t reserved; //<! Sempre 0.
+};
+
+static_assert( sizeof( OutputRecord ) == 16, "OutputRecord deve ter 16 bytes" );
+static_assert( std::is_trivially_copyable< OutputRecord >::value, "OutputRecord é copiado com memcpy" );
+
+/**
+ * @brief      Escreve os resultados das expressões em um buffer grande e
+ *             reaproveitado, em um dos formatos:
+ *
+ *             TEXT    as mensagens de sempre, uma por linha;
+ *             JSONL   {"code":"OK","value":3}, {"code":"MISSING_TERM","column":3}
+ *                     ou {"code":"DIVISION_BY_ZERO"}, um objeto por linha;
+ *             BINARY  um OutputRecord por expressão.
+ *
+ *             Os inteiros são formatados com std::to_chars e as mensagens de
+ *             erro são modelos já prontos em que só a coluna é inserida.
+ *
+ *             Com um descritor, o buffer é escrito nele sempre que passa de
+ *             FLUSH_SIZE e no destrutor; quem precisa saber se a saída foi
+ *             toda escrita chama flush() no fim. Sem descritor (-1), o
+ *             chamador lê o conteúdo com view() e o descarta com clear().
+ */
+class OutputWriter
+{
+    public:
+        //=== Formatos
+        enum class format_t : std::uint8_t
+        {
+            TEXT = 0,
+            JSONL,
+            BINARY
+        };
+
+        //=== Constantes
+        static constexpr std::size_t FLUSH_SIZE = 256 * 1024; //<! Tamanho que dispara a escrita no descritor.
+
+        /**
+         * @brief      Cria o escritor
+         *
+         * @param[in]  format_  Formato da saída
+         * @param[in]  fd_      Descritor de destino (-1: apenas acumula)
+         */
+        explicit OutputWriter( format_t format_ = format_t::TEXT, int fd_ = -1 );
+
+        /**
+         * @brief      Escreve o resultado de um cálculo (valor ou erro)
+         *
+         * @param[in]  result_  Resultado do Bares
+         */
+        void result( const Bares::Result & result_ );
+
+        /**
+         * @brief      Escreve o erro de parsing de uma expressão
+         *
+         * @param[in]  result_  Resultado do Tokenizer (diferente de OK)
+         */
+        void parse_error( const Tokenizer::Result & result_ );
+
+        /**
+         * @brief      Acrescenta bytes já formatados (por outro OutputWriter)
+         *
+         * @param[in]  bytes_  Os bytes
+         */
+        void raw( std::string_view bytes_ );
+
+        /**
+         * @brief      Escreve o buffer no descritor (se houver). Depois de uma
+         *             falha, o que vier é descartado.
+         *
+         * @return     False se esta ou alguma escrita anterior (inclusive as
+         *             disparadas por FLUSH_SIZE) falhou
+         */
+        bool flush( void );
+
+        /**
+         * @brief      Conteúdo ainda não escrito
+         */
+        std::string_view view( void ) const
+        {  return buffer; }
+
+        /**
+         * @brief      Descarta o conteúdo, mantendo a memória
+         */
+        void clear( void )
+        {  buffer.clear(); }
+
+        /**
+         * @brief      O formato da saída
+         */
+        format_t format( void ) const
+        {  return fmt; }
+
+        /**
+         * @brief      Converte o nome de um formato ("text", "jsonl", "binary")
+         *
+         * @param[in]  name_    O nome
+         * @param[out] format_  O formato
+         *
+         * @return     False se o nome não for conhecido
+         */
+        static bool parse_format( std::string_view name_, format_t & format_ );
+
+        //==== Métodos Especiais
+
+        /**
+         * @brief      Escreve o que restar no descritor
+         */
+        ~OutputWriter();
+
+        /**
+         * @brief      Construtor Cópia (removido)
+         */
+        OutputWriter( const OutputWriter & ) = delete;
+
+        /**
+         * @brief      Atribuição (removida)
+         */
+        OutputWriter & operator=( const OutputWriter & ) = delete;
+
+    private:
+        format_t fmt;       //<! Formato da saída.
+        int fd;             //<! Descritor de destino (ou -1).
+        std::string buffer; //<! Saída ainda não escrita.
+        bool failed;        //<! Alguma escrita no descritor falhou.
+
+        /**
+         * @brief      Acrescenta um inteiro em decimal
+         */
+        void append_int( std::int64_t v_ );
+
+        /**
+         * @brief      Acrescenta um registro binário
+         */
+        void append_record( std::int64_t value_, std::uint32_t column_, std::uint8_t kind_, std::uint8_t code_ );
+
+        /**
+         * @brief      Escreve o buffer se ele passou de FLUSH_SIZE
+         */
+        void maybe_flush( void )
+        {
+            if ( fd >= 0 and buffer.size() >= FLUSH_SIZE )
+                flush();
+        }
+};
+
+#endif
@@ -0,0 +1,126 @@
+/**
+ * @file parallel_tokenizer.h
+ * @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+ * @date 18 Outubro 2026
+ * @brief Arquivo contendo as definições da classe ParallelTokenizer, que faz
+ *        o parsing de uma única expressão muito longa em paralelo.
+ */
+
+#ifndef _PARALLEL_TOKENIZER_H_
+#define _PARALLEL_TOKENIZER_H_
+
+#include <cstdint>     // std::uint8_t
+#include <string_view> // std::string_view
+#include <vector>      // std::vector
+
+#include "tokenizer.h"          // Tokenizer
+#include "work_stealing_pool.h" // WorkStealingPool, TaskGroup
+
+/**
+ * @brief      Parsing paralelo de expressões longas (sem variáveis).
+ *
+ *             A linha é dividida em blocos que terminam logo após um "+",
+ *             "*", "/", "%", "^", "(" ou ")": esses caracteres nunca fazem
+ *             parte de um termo, e o que se espera depois deles (um termo ou
+ *             um operador) não depende do resto da linha. Cada bloco é lido
+ *             por uma tarefa do pool, que gera os seus Tokens (com as
+ *             colunas da linha inteira) e a variação e o mínimo da
+ *             profundidade dos parênteses; a soma de prefixos dessas
+ *             variações dá a profundidade na entrada de cada bloco. No fim,
+ *             os Tokens dos blocos são copiados em ordem para uma única
+ *             lista.
+ *
+ *             A leitura em paralelo só aceita expressões válidas. Qualquer
+ *             erro (ou uma linha curta) faz o parsing sequencial de
+ *             Tokenizer, que devolve o mesmo Result, com a mesma coluna, e
+ *             os mesmos Tokens.
+ */
+class ParallelTokenizer
+{
+    public:
+        //=== Alias
+        using Result = Tokenizer::Result;
+
+        /**
+         * @brief      Cria o parser
+         *
+         * @param      pool_  Pool que executa as tarefas
+         */
+        explicit ParallelTokenizer( WorkStealingPool & pool_ )
+            : pool( pool_ )
+        {/* empty */}
+
+        /**
+         * @brief      Faz o parsing da expressão (igual a Tokenizer::parse)
+         *
+         * @param[in]  e_    Expressão (precisa continuar válida só durante
+         *                   a chamada)
+         *
+         * @return     O resultado do parsing
+         */
+        Result parse( std::string_view e_ );
+
+        /**
+         * @brief      A lista de Tokens (válida até o próximo parse())
+         */
+        const std::vector< Token > & get_tokens( void ) const
+        {  return *tokens; }
+
+        //==== Métodos Especiais
+
+        /**
+         * @brief      Construtor Cópia (removido)
+         */
+        ParallelTokenizer( const ParallelTokenizer & ) = delete;
+
+        /**
+         * @brief      Atribuição (removida)
+         */
+        ParallelTokenizer & operator=( const ParallelTokenizer & ) = delete;
+
+    private:
+        /**
+         * @brief      O que pode vir a seguir em uma posição da expressão
+         */
+        enum class state_t : std::uint8_t
+        {
+            TERM,     //<! Um termo: "(", constante (no início, após "(" ou operador).
+            OPERATOR  //<! Um operador ou ")" (após constante ou ")").
+        };
+
+        /**
+         * @brief      Um trecho [begin, end) da expressão, lido por uma tarefa
+         */
+        struct Chunk
+        {
+            std::size_t begin = 0;                  //<! Início na expressão.
+            std::size_t end = 0;                    //<! Fim (exclusivo).
+            state_t enter = state_t::TERM;          //<! Estado no início do bloco.
+            state_t leave = state_t::TERM;          //<! Estado no fim do bloco.
+            bool ok = false;                        //<! O bloco foi lido sem erro.
+            long depth = 0;                         //<! Variação da profundidade dos parênteses.
+            long min_depth = 0;                     //<! Menor profundidade (relativa) dentro do bloco.
+            std::size_t offset = 0;                 //<! Posição do primeiro Token na lista final.
+            std::vector< Token > tokens;            //<! Tokens do bloco.
+        };
+
+        WorkStealingPool & pool;                //<! O pool.
+        Tokenizer sequential;                   //<! Parsing sequencial (linhas curtas e erros).
+        std::vector< Chunk > chunks;            //<! Blocos (reaproveitados entre chamadas).
+        std::vector< Token > merged;            //<! Tokens da última leitura em paralelo.
+        const std::vector< Token > * tokens = &merged; //<! merged, ou os Tokens de sequential.
+
+        /**
+         * @brief      Divide a expressão em blocos
+         *
+         * @return     False se não há pelo menos dois blocos
+         */
+        bool split( std::string_view e_ );
+
+        /**
+         * @brief      Lê um bloco
+         */
+        static void lex( std::string_view e_, Chunk & c_ );
+};
+
+#endif
@@ -0,0 +1,82 @@
+/**
+ * @file reorder_buffer.h
+ * @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+ * @date 18 Outubro 2026
+ * @brief Arquivo contendo as definições do buffer que devolve, na ordem de
+ *        entrada, blocos de saída produzidos fora de ordem.
+ */
+
+#ifndef _REORDER_BUFFER_H_
+#define _REORDER_BUFFER_H_
+
+#include <condition_variable> // std::condition_variable
+#include <mutex>              // std::mutex
+#include <string>             // std::string
+#include <vector>             // std::vector
+
+/**
+ * @brief      Janela circular de blocos numerados.
+ *
+ *             Produtores depositam o bloco de número seq em qualquer ordem;
+ *             o consumidor retira os blocos estritamente em ordem crescente.
+ *             Apenas `capacity` blocos podem estar em trânsito ao mesmo tempo.
+ */
+class ReorderBuffer
+{
+    public:
+        /**
+         * @brief      Cria o buffer
+         *
+         * @param[in]  capacity_  Número máximo de blocos em trânsito
+         */
+        explicit ReorderBuffer( std::size_t capacity_ );
+
+        /**
+         * @brief      Bloqueia até que o bloco seq caiba na janela
+         *
+         * @param[in]  seq_  Número do bloco
+         */
+        void wait_for_slot( std::size_t seq_ );
+
+        /**
+         * @brief      Deposita um bloco pronto
+         *
+         * @param[in]  seq_   Número do bloco
+         * @param[in]  data_  Conteúdo do bloco
+         */
+        void put( std::size_t seq_, std::string data_ );
+
+        /**
+         * @brief      Informa o total de blocos que serão produzidos
+         *
+         * @param[in]  total_  Número total de blocos
+         */
+        void finish( std::size_t total_ );
+
+        /**
+         * @brief      Retira o próximo bloco na ordem de entrada
+         *
+         * @param[out] data_  Conteúdo do bloco
+         *
+         * @return     False quando todos os blocos já foram retirados
+         */
+        bool pop( std::string & data_ );
+
+    private:
+        /**
+         * @brief      Posição da janela
+         */
+        struct Slot
+        {
+            bool ready = false; //<! O bloco já foi depositado.
+            std::string data;   //<! Conteúdo do bloco.
+        };
+
+        std::vector< Slot > slots;   //<! A janela circular.
+        std::size_t next;            //<! Próximo bloco a ser retirado.
+        std::size_t total;           //<! Total de blocos (conhecido após finish()).
+        std::mutex m;                //<! Protege o estado.
+        std::condition_variable cv;  //<! Sinaliza mudanças de estado.
+};
+
+#endif
@@ -0,0 +1,130 @@
+/**
+ * @file result_cache.h
+ * @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+ * @date 18 Outubro 2026
+ * @brief Arquivo contendo as definições do cache LRU de resultados,
+ *        indexado pela sequência de Tokens da expressão.
+ */
+
+#ifndef _RESULT_CACHE_H_
+#define _RESULT_CACHE_H_
+
+#include <cstdint>       // std::uint64_t
+#include <list>          // std::list
+#include <string>        // std::string
+#include <string_view>   // std::string_view
+#include <unordered_map> // std::unordered_map
+#include <vector>        // std::vector
+
+#include "token.h"
+#include "bares.h"
+
+/**
+ * @brief      Cache de resultados com limite de memória e descarte LRU.
+ *
+ *             A chave é a sequência de Tokens sem as colunas (tipo,
+ *             operador e valor de cada um), de modo que expressões que só
+ *             diferem em espaços compartilham a mesma entrada. Guarda tanto
+ *             valores quanto erros de cálculo. Não é thread-safe: cada
+ *             Evaluator possui o seu.
+ */
+class ResultCache
+{
+    public:
+        /**
+         * @brief      Cria o cache
+         *
+         * @param[in]  capacity_  Limite aproximado de memória, em bytes
+         */
+        explicit ResultCache( std::size_t capacity_ = 0 );
+
+        /**
+         * @brief      Monta a chave normalizada de uma lista de Tokens
+         *
+         * @param[in]  tokens_  Os Tokens da expressão
+         * @param[out] key_     A chave (4 bytes por Token)
+         */
+        static void make_key( const std::vector< Token > & tokens_, std::string & key_ );
+
+        /**
+         * @brief      Procura a chave e, se encontrada, a torna a mais recente
+         *
+         * @param[in]  key_  A chave
+         *
+         * @return     O resultado guardado, ou nullptr se não houver
+         */
+        const Bares::Result * find( std::string_view key_ );
+
+        /**
+         * @brief      Guarda o resultado, descartando as entradas menos
+         *             recentes até caber no limite de memória
+         *
+         * @param[in]  key_     A chave
+         * @param[in]  result_  O resultado do cálculo
+         */
+        void insert( std::string_view key_, const Bares::Result & result_ );
+
+        /**
+         * @brief      Verifica se o cache está ligado (limite maior que zero)
+         */
+        bool enabled( void ) const
+        {  return capacity > 0; }
+
+        /**
+         * @brief      Número de buscas encontradas
+         */
+        std::size_t hits( void ) const
+        {  return n_hits; }
+
+        /**
+         * @brief      Número de buscas não encontradas
+         */
+        std::size_t misses( void ) const
+        {  return n_misses; }
+
+        /**
+         * @brief      Número de entradas guardadas
+         */
+        std::size_t size( void ) const
+        {  return entries.size(); }
+
+        /**
+         * @brief      Memória estimada em uso, em bytes
+         */
+        std::size_t bytes( void ) const
+        {  return used; }
+
+    private:
+        /**
+         * @brief      Entrada do cache
+         */
+        struct Entry
+        {
+            std::string key;      //<! Chave normalizada.
+            Bares::Result result; //<! Resultado guardado.
+        };
+
+        /**
+         * @brief      Hash FNV-1a de 64 bits sobre a chave
+         */
+        struct KeyHash
+        {
+            std::size_t operator()( std::string_view key_ ) const;
+        };
+
+        using list_type = std::list< Entry >;
+
+        list_type entries; //<! Entradas, da mais para a menos recente.
+        std::unordered_map< std::string_view, list_type::iterator, KeyHash > index; //<! Chave -> entrada.
+        std::size_t capacity; //<! Limite de memória.
+        std::size_t used;     //<! Memória estimada em uso.
+        std::size_t n_hits;   //<! Buscas encontradas.
+        std::size_t n_misses; //<! Buscas não encontradas.
+
+        /**
+         * @brief      Memória estimada ocupada por uma entrada com a chave
+         */
+        static std::size_t cost( std::string_view key_ );
+};
+
+#endif
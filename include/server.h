@@ -0,0 +1,106 @@
+/**
+ * @file server.h
+ * @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+ * @date 18 Outubro 2026
+ * @brief Arquivo contendo as definições do modo servidor (daemon) em um
+ *        socket Unix e do cliente correspondente.
+ */
+
+#ifndef _SERVER_H_
+#define _SERVER_H_
+
+#include <string>   // std::string
+
+#include "evaluator.h"
+
+/**
+ * @brief      Servidor persistente em um socket Unix (SOCK_STREAM).
+ *
+ *             Cada requisição é uma linha terminada em '\n' e cada resposta
+ *             é a linha que o modo sequencial escreveria para ela, na mesma
+ *             ordem. Um cliente pode enviar muitas linhas sem esperar as
+ *             respostas; ao fechar a escrita (shutdown), a última linha sem
+ *             '\n' também é avaliada e a conexão é encerrada depois que
+ *             todas as respostas forem enviadas. Uma linha maior que
+ *             IN_MAX bytes encerra a conexão do mesmo modo: as respostas
+ *             das linhas anteriores são enviadas e o resto é descartado.
+ *
+ *             Cada thread trabalhadora possui o seu Evaluator (que continua
+ *             aquecido entre requisições) e a sua instância epoll, onde
+ *             aceita conexões (EPOLLEXCLUSIVE) e atende as suas próprias.
+ */
+class Server
+{
+    public:
+        /**
+         * @brief      Cria o socket e começa a escutar em path_
+         *
+         * @param[in]  path_       Caminho do socket (um arquivo antigo é removido)
+         * @param[in]  n_threads_  Número de threads trabalhadoras (0 vira 1)
+         * @param[in]  options_    Opções de avaliação
+         *
+         * @throw      std::runtime_error se o socket não puder ser criado
+         */
+        Server( const std::string & path_, std::size_t n_threads_, const EvalOptions & options_ = EvalOptions() );
+
+        /**
+         * @brief      Atende os clientes até stop()
+         */
+        void run( void );
+
+        /**
+         * @brief      Pede o término de run(); pode ser chamado de um
+         *             tratador de sinal
+         */
+        void stop( void );
+
+        //==== Métodos Especiais
+
+        /**
+         * @brief      Fecha as conexões e remove o arquivo do socket
+         */
+        ~Server();
+
+        /**
+         * @brief      Construtor Cópia (removido)
+         */
+        Server( const Server & ) = delete;
+
+        /**
+         * @brief      Atribuição (removida)
+         */
+        Server & operator=( const Server & ) = delete;
+
+    private:
+        //=== Constantes
+        static constexpr std::size_t READ_SIZE = 64 * 1024;   //<! Bytes lidos por chamada a read().
+        static constexpr std::size_t OUT_HIGH = 1024 * 1024;  //<! Respostas pendentes que suspendem a leitura.
+        static constexpr std::size_t IN_MAX = 4 * 1024 * 1024; //<! Maior linha aceita (sem o '\n').
+        static constexpr int MAX_EVENTS = 64;                 //<! Eventos tratados por epoll_wait().
+
+        std::string path;      //<! Caminho do socket.
+        std::size_t n_threads; //<! Threads trabalhadoras.
+        EvalOptions options;   //<! Opções de avaliação.
+        int listen_fd;         //<! Socket que aceita conexões.
+        int stop_fd;           //<! eventfd sinalizado por stop().
+
+        /**
+         * @brief      Laço de uma thread trabalhadora
+         */
+        void worker( void );
+};
+
+/**
+ * @brief      Cliente: envia a entrada ao servidor e escreve as respostas
+ *
+ * @param[in]  path_    Caminho do socket
+ * @param[in]  in_fd_   Descritor de onde as linhas são lidas
+ * @param[in]  out_fd_  Descritor onde as respostas são escritas
+ *
+ * @return     True se tudo foi enviado e recebido sem erros
+ *
+ * @throw      std::runtime_error se não for possível conectar
+ */
+bool run_client( const std::string & path_, int in_fd_, int out_fd_ );
+
+#endif
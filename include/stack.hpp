@@ -5,22 +5,36 @@
 #include <stdexcept>
 #include <cassert>
 #include <iterator>
+#include <memory>   // std::allocator, std::allocator_traits
+#include <utility>  // std::move, std::forward
 
 namespace ls{ 
-    template <typename T>
+    /**
+     * @brief      Pilha com armazenamento interno para até N elementos.
+     *
+     *             Enquanto a pilha tem no máximo N elementos, eles ficam
+     *             dentro do próprio objeto; acima disso a área é obtida de
+     *             Alloc (por exemplo, ls::ArenaAllocator), crescendo em dobro.
+     */
+    template < typename T, std::size_t N = 16, typename Alloc = std::allocator<T> >
     class Stack
     {
         private:
-            static const std::size_t SIZE = 10;
+            using traits = std::allocator_traits<Alloc>;
+
+            Alloc m_alloc;          //<! Alocador da área externa
             std::size_t m_top;      //<! Topo da pilha
             std::size_t m_capacity; //<!Tamanho físico
             T * m_data;             //<! Area de armazenamento
+            alignas(T) unsigned char m_inline[ N * sizeof(T) ]; //<! Área interna
 
-            //Amplia a area de armazenamento
-            void reserve( std::size_t new_cap);
+            //Verifica se a área em uso é a interna
+            bool is_inline( void ) const
+            {  return m_data == reinterpret_cast< const T * >( m_inline ); }
 
         public:
-            Stack( std::size_t cap = SIZE);
+            explicit Stack( const Alloc & alloc = Alloc() );
+            explicit Stack( std::size_t cap, const Alloc & alloc = Alloc() );
             
             ~Stack();
 
@@ -28,13 +42,25 @@ namespace ls{
             Stack & operator=(const Stack &) = delete;
 
             void push( const T & value);
+            void push( T && value);
+
+            template < typename... Args >
+            T & emplace( Args &&... args );
+
             T pop ( void );           //pode lançar std::length_error
-            T top( void );  
+            T & top( void );
+            const T & top( void ) const;
+
+            bool empty( void ) const;
+            std::size_t size( void ) const;
+            std::size_t capacity( void ) const;
+            void clear( void );
 
-            bool empty( void );
+            //Amplia a area de armazenamento
+            void reserve( std::size_t new_cap);
     };
 }
 
 #include "stack.inl"
 
-#endif
\ No newline at end of file
+#endif
@@ -9,50 +9,89 @@
 #include <stdexcept>
 
 //<! Construtor padrão.
-template <typename T>
-ls::Stack<T>::Stack( std::size_t cap)
-    : m_top(0), 
-    m_capacity(cap), 
-    m_data(new T[cap])
+template <typename T, std::size_t N, typename Alloc>
+ls::Stack<T, N, Alloc>::Stack( const Alloc & alloc )
+    : m_alloc(alloc),
+    m_top(0), 
+    m_capacity(N), 
+    m_data(reinterpret_cast< T * >( m_inline ))
     { /*empty*/}
 
+//<! Construtor com capacidade inicial.
+template <typename T, std::size_t N, typename Alloc>
+ls::Stack<T, N, Alloc>::Stack( std::size_t cap, const Alloc & alloc )
+    : Stack( alloc )
+    { reserve( cap ); }
+
 //<! Destrói o objeto. 
-template <typename T>
-ls::Stack<T>::~Stack()
-{ delete [] m_data; }
+template <typename T, std::size_t N, typename Alloc>
+ls::Stack<T, N, Alloc>::~Stack()
+{
+    clear();
+    if ( not is_inline() )
+        traits::deallocate( m_alloc, m_data, m_capacity );
+}
+
+//<! Insere um elemento na pilha (cópia).
+template <typename T, std::size_t N, typename Alloc>
+void ls::Stack<T, N, Alloc>::push(const T & value){
+    emplace( value );
+}
+
+//<! Insere um elemento na pilha (movido).
+template <typename T, std::size_t N, typename Alloc>
+void ls::Stack<T, N, Alloc>::push(T && value){
+    emplace( std::move( value ) );
+}
 
-//<! Insere um elemento na pilha.
-template <typename T>
-void ls::Stack<T>::push(const T & value){
-    if(m_top == m_capacity) reserve(m_capacity * 2);
+//<! Constrói um elemento diretamente no topo da pilha.
+template <typename T, std::size_t N, typename Alloc>
+template <typename... Args>
+T & ls::Stack<T, N, Alloc>::emplace( Args &&... args ){
+    if(m_top == m_capacity) reserve( m_capacity == 0 ? 1 : m_capacity * 2 );
 
-    m_data[m_top++] = value;
+    T * slot = ::new ( static_cast< void * >( m_data + m_top ) ) T( std::forward<Args>( args )... );
+    ++m_top;
+    return *slot;
 }
 
 //<! Remove último elemento da pilha.
-template <typename T>
-T ls::Stack<T>::pop( void ){
+template <typename T, std::size_t N, typename Alloc>
+T ls::Stack<T, N, Alloc>::pop( void ){
     if(m_top == 0) 
         throw std::length_error("[pop()] Cannot recover element from an empty vector.");
 
-    return m_data[--m_top];
+    T & last = m_data[--m_top];
+    T value( std::move( last ) );
+    last.~T();
+    return value;
 }
 
 //<! Retorna elemento no topo da pilha.
-template <typename T>
-T ls::Stack<T>::top() 
-{  return m_data[m_top-1]; }
+template <typename T, std::size_t N, typename Alloc>
+T & ls::Stack<T, N, Alloc>::top() 
+{  assert( m_top > 0 ); return m_data[m_top-1]; }
+
+//<! Retorna elemento no topo da pilha (constante).
+template <typename T, std::size_t N, typename Alloc>
+const T & ls::Stack<T, N, Alloc>::top() const
+{  assert( m_top > 0 ); return m_data[m_top-1]; }
 
 
 //<! Aumenta a capacidade de armazenamento da pilha para um valor que é maior ou igual a new_cap.
-template <typename T>
-void ls::Stack<T>::reserve( std::size_t new_cap ){
+template <typename T, std::size_t N, typename Alloc>
+void ls::Stack<T, N, Alloc>::reserve( std::size_t new_cap ){
     if(new_cap > m_capacity){
-        T *temp = new T[ new_cap ]; //Novo vetor
+        T *temp = traits::allocate( m_alloc, new_cap ); //Novo vetor
 
-        std::copy(m_data, m_data + new_cap, temp);  //Copia para novo vetor
+        //Move apenas os elementos existentes para o novo vetor
+        for ( std::size_t i = 0; i < m_top; ++i ){
+            ::new ( static_cast< void * >( temp + i ) ) T( std::move( m_data[i] ) );
+            m_data[i].~T();
+        }
 
-        delete m_data;
+        if ( not is_inline() )
+            traits::deallocate( m_alloc, m_data, m_capacity );
 
         m_data = temp;                          //Aponta para o novo endereço
         m_capacity = new_cap; //Atualizar tamanho;
@@ -60,6 +99,24 @@ void ls::Stack<T>::reserve( std::size_t new_cap ){
 }
 
 //<! Verifica se pilha está vazia.
-template <typename T>
-bool ls::Stack<T>::empty() 
+template <typename T, std::size_t N, typename Alloc>
+bool ls::Stack<T, N, Alloc>::empty() const
 {  return m_top == 0; }
+
+//<! Número de elementos na pilha.
+template <typename T, std::size_t N, typename Alloc>
+std::size_t ls::Stack<T, N, Alloc>::size() const
+{  return m_top; }
+
+//<! Capacidade atual da pilha.
+template <typename T, std::size_t N, typename Alloc>
+std::size_t ls::Stack<T, N, Alloc>::capacity() const
+{  return m_capacity; }
+
+//<! Remove todos os elementos (a área é mantida).
+template <typename T, std::size_t N, typename Alloc>
+void ls::Stack<T, N, Alloc>::clear() 
+{
+    while ( m_top > 0 )
+        m_data[--m_top].~T();
+}
@@ -0,0 +1,225 @@
+/**
+ * @file stats.h
+ * @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+ * @date 18 Outubro 2026
+ * @brief Arquivo contendo as definições das estatísticas de execução
+ *        (contadores e histogramas de latência por estágio).
+ */
+
+#ifndef _STATS_H_
+#define _STATS_H_
+
+#include <atomic>             // std::atomic
+#include <chrono>             // std::chrono::steady_clock
+#include <condition_variable> // std::condition_variable
+#include <cstdint>            // std::uint64_t
+#include <deque>              // std::deque
+#include <memory>             // std::unique_ptr
+#include <mutex>              // std::mutex
+#include <ostream>            // std::ostream
+#include <string>             // std::string
+#include <thread>             // std::thread
+
+#include "tokenizer.h"
+#include "bares.h"
+
+namespace stats {
+
+    //<! Número de códigos de Tokenizer::Result e Bares::Result.
+    constexpr std::size_t N_TOKENIZER_CODES = Tokenizer::Result::TOO_MANY_VARIABLES + 1;
+    constexpr std::size_t N_BARES_CODES = Bares::Result::NUMERIC_OVERFLOW + 1;
+
+    //<! Baldes dos histogramas: o balde k guarda valores em [2^(k-1), 2^k).
+    constexpr std::size_t N_BUCKETS = 48;
+
+    /**
+     * @brief      Estágios medidos
+     */
+    enum stage_t
+    {
+        TOKENIZE = 0, // Tokenizer::parse
+        POSTFIX,      // Bares::infix_to_postfix
+        EVALUATE,     // Compilação e execução na VM
+        OUTPUT,       // Escrita do resultado/mensagem
+        FUSED,        // FusedEvaluator::run (parsing e cálculo juntos)
+        N_STAGES
+    };
+
+    using clock_type = std::chrono::steady_clock;
+
+    /**
+     * @brief      Histograma com baldes em potências de 2 (sem cópia: os
+     *             campos são atômicos para poderem ser lidos por outra thread)
+     */
+    struct Histogram
+    {
+        std::atomic< std::uint64_t > buckets[ N_BUCKETS ] = {}; //<! Contagem de cada balde.
+        std::atomic< std::uint64_t > count{ 0 };                //<! Número de amostras.
+        std::atomic< std::uint64_t > sum{ 0 };                  //<! Soma das amostras.
+
+        /**
+         * @brief      Registra uma amostra (um único escritor por histograma)
+         */
+        void record( std::uint64_t v_ );
+    };
+
+    /**
+     * @brief      Contadores de uma thread. Só a thread dona escreve; o
+     *             relatório lê a qualquer momento.
+     */
+    struct Counters
+    {
+        std::atomic< std::uint64_t > lines{ 0 };                       //<! Linhas processadas.
+        std::atomic< std::uint64_t > tokenizer[ N_TOKENIZER_CODES ] = {}; //<! Resultados do parsing.
+        std::atomic< std::uint64_t > bares[ N_BARES_CODES ] = {};      //<! Resultados do cálculo.
+        std::atomic< std::uint64_t > cache_hits{ 0 };                  //<! Acertos do cache.
+        Histogram tokens;                                              //<! Tokens por expressão.
+        Histogram latency[ N_STAGES ];                                 //<! Latência (ns) por estágio.
+
+        /**
+         * @brief      Registra o resultado do parsing de uma linha
+         *
+         * @param[in]  code_     Código do Tokenizer
+         * @param[in]  n_tokens_ Número de Tokens (só conta se OK; 0 = desconhecido)
+         */
+        void parsed( Tokenizer::Result::code_t code_, std::size_t n_tokens_ );
+
+        /**
+         * @brief      Registra o resultado do cálculo de uma expressão
+         */
+        void evaluated( Bares::Result::code_t code_ );
+
+        /**
+         * @brief      Registra um resultado vindo do cache
+         */
+        void cached( Bares::Result::code_t code_ );
+
+        /**
+         * @brief      Registra a duração de um estágio iniciado em start_
+         *
+         * @return     O instante atual (início do próximo estágio)
+         */
+        clock_type::time_point lap( stage_t stage_, clock_type::time_point start_ );
+    };
+
+    /**
+     * @brief      Soma dos contadores de todas as threads num instante
+     */
+    struct Snapshot
+    {
+        std::uint64_t lines = 0;
+        std::uint64_t tokenizer[ N_TOKENIZER_CODES ] = {};
+        std::uint64_t bares[ N_BARES_CODES ] = {};
+        std::uint64_t cache_hits = 0;
+
+        /**
+         * @brief      Cópia não atômica de um histograma
+         */
+        struct Hist
+        {
+            std::uint64_t buckets[ N_BUCKETS ] = {};
+            std::uint64_t count = 0;
+            std::uint64_t sum = 0;
+
+            /**
+             * @brief      Limite superior do balde que contém o quantil q_
+             */
+            std::uint64_t quantile( double q_ ) const;
+        };
+        Hist tokens;
+        Hist latency[ N_STAGES ];
+
+        /**
+         * @brief      Acrescenta os contadores de uma thread
+         */
+        void add( const Counters & c_ );
+
+        /**
+         * @brief      Escreve em JSON (um objeto, seguido de '\n')
+         */
+        void write_json( std::ostream & os_ ) const;
+
+        /**
+         * @brief      Escreve no formato texto do Prometheus
+         */
+        void write_prom( std::ostream & os_ ) const;
+    };
+
+    /**
+     * @brief      Formatos de relatório
+     */
+    enum class format_t { JSON, PROM };
+
+    /**
+     * @brief      Dono dos contadores de todas as threads
+     */
+    class Registry
+    {
+        public:
+            /**
+             * @brief      Cria um bloco de contadores para uma thread; ele
+             *             vive até o fim do Registry
+             */
+            Counters * add( void );
+
+            /**
+             * @brief      Soma os contadores de todas as threads
+             */
+            Snapshot snapshot( void );
+
+            /**
+             * @brief      Escreve o relatório no formato pedido
+             */
+            void write( std::ostream & os_, format_t format_ );
+
+        private:
+            std::mutex m;                                  //<! Protege blocks.
+            std::deque< std::unique_ptr< Counters > > blocks; //<! Um bloco por thread.
+    };
+
+    /**
+     * @brief      Grava o relatório num arquivo a cada intervalo, numa
+     *             thread própria, até ser destruído
+     */
+    class Reporter
+    {
+        public:
+            /**
+             * @brief      Inicia a thread de relatório
+             *
+             * @param      registry_  Os contadores
+             * @param[in]  format_    Formato do relatório
+             * @param[in]  path_      Arquivo (reescrito a cada vez; vazio = stderr)
+             * @param[in]  seconds_   Intervalo entre relatórios
+             */
+            Reporter( Registry & registry_, format_t format_, std::string path_, unsigned seconds_ );
+
+            /**
+             * @brief      Para a thread
+             */
+            ~Reporter();
+
+            Reporter( const Reporter & ) = delete;
+            Reporter & operator=( const Reporter & ) = delete;
+
+        private:
+            Registry & registry;
+            format_t format;
+            std::string path;
+            unsigned seconds;
+            bool stop;
+            std::mutex m;
+            std::condition_variable cv;
+            std::thread worker;
+    };
+
+    /**
+     * @brief      Grava o relatório em path_ (troca atômica via arquivo
+     *             temporário) ou em stderr se path_ for vazio
+     *
+     * @return     True se gravou
+     */
+    bool dump( Registry & registry_, format_t format_, const std::string & path_ );
+}
+
+#endif
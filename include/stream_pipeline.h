@@ -0,0 +1,115 @@
+/**
+ * @file stream_pipeline.h
+ * @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+ * @date 18 Outubro 2026
+ * @brief Arquivo contendo as definições do modo de avaliação em fluxo
+ *        (streaming), com memória limitada.
+ */
+
+#ifndef _STREAM_PIPELINE_H_
+#define _STREAM_PIPELINE_H_
+
+#include <iostream> // std::ostream
+#include <string>   // std::string
+#include <vector>   // std::vector
+
+#include "bounded_queue.hpp"
+#include "tokenizer.h"
+#include "evaluator.h"
+
+/**
+ * @brief      Pipeline de estágios ligados por filas limitadas:
+ *
+ *             leitura de blocos -> separação de linhas -> parsing ->
+ *             avaliação -> escrita.
+ *
+ *             Cada estágio roda em sua própria thread; a memória usada
+ *             depende apenas da capacidade das filas e não do tamanho da
+ *             entrada.
+ */
+class StreamPipeline
+{
+    public:
+        /**
+         * @brief      Cria o pipeline
+         *
+         * @param[in]  in_fd_    Descritor de arquivo de entrada
+         * @param      out_      Fluxo de saída
+         * @param[in]  options_  Opções de avaliação
+         */
+        StreamPipeline( int in_fd_, std::ostream & out_, const EvalOptions & options_ = EvalOptions() );
+
+        /**
+         * @brief      Construtor Cópia (removido)
+         */
+        StreamPipeline( const StreamPipeline & ) = delete;
+
+        /**
+         * @brief      Atribuição (removida)
+         */
+        StreamPipeline & operator=( const StreamPipeline & ) = delete;
+
+        /**
+         * @brief      Executa o pipeline até o fim da entrada
+         *
+         * @return     True se a entrada foi lida e a saída escrita sem erros
+         */
+        bool run( void );
+
+    private:
+        //=== Aliases
+        using line_batch = std::vector< std::string >; //<! Linhas consecutivas da entrada.
+
+        /**
+         * @brief      Linha após o parsing
+         */
+        struct ParsedLine
+        {
+            Tokenizer::Result result;    //<! Resultado do parsing.
+            std::vector< Token > tokens; //<! Tokens (se result for OK).
+        };
+        using parsed_batch = std::vector< ParsedLine >;
+
+        static constexpr std::size_t READ_SIZE   = 64 * 1024; //<! Tamanho de cada leitura.
+        static constexpr std::size_t BATCH_LINES = 256;       //<! Linhas por lote.
+        static constexpr std::size_t QUEUE_CAP   = 16;        //<! Capacidade de cada fila.
+
+        int in_fd;          //<! Entrada.
+        std::ostream & out; //<! Saída.
+        bool read_ok;       //<! A leitura terminou sem erros.
+        EvalOptions options; //<! Opções de avaliação.
+
+        ls::BoundedQueue< std::string >  chunks;  //<! leitura -> separação
+        ls::BoundedQueue< line_batch >   lines;   //<! separação -> parsing
+        ls::BoundedQueue< parsed_batch > parsed;  //<! parsing -> avaliação
+        ls::BoundedQueue< std::string >  outputs; //<! avaliação -> escrita
+
+        //=== Estágios
+
+        /**
+         * @brief      Lê blocos da entrada assim que estiverem disponíveis
+         */
+        void read_stage( void );
+
+        /**
+         * @brief      Separa os blocos em lotes de linhas
+         */
+        void split_stage( void );
+
+        /**
+         * @brief      Faz o parsing de cada linha
+         */
+        void parse_stage( void );
+
+        /**
+         * @brief      Avalia as linhas válidas e formata a saída de cada lote
+         */
+        void eval_stage( void );
+
+        /**
+         * @brief      Escreve a saída de cada lote assim que ela fica pronta
+         */
+        void write_stage( void );
+};
+
+#endif
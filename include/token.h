@@ -8,39 +8,78 @@
 #ifndef _TOKEN_H_
 #define _TOKEN_H_
 
-#include <string>   // std::string
-#include <iostream> // std::ostream
+#include <cstdint>     // std::int16_t, std::uint32_t
+#include <iostream>    // std::ostream
+#include <type_traits> // std::is_trivially_copyable
 
 /**
- * @brief      Representação de um Token
+ * @brief      Enumerações comuns a todas as larguras de Token
  */
-struct Token
+struct TokenKinds
 {
     public:
 
         /**
          * @brief      Enumeração para os tipos de Token
          */
-        enum class token_t : int
+        enum class token_t : std::uint8_t
         {
             OPERAND = 0,   // Basically numbers.
             OPERATOR,      // "+", "-". "^", "%", "*", "/"
             CLOSING_SCOPE, // ")"
             OPENING_SCOPE, // "("
+            VARIABLE,      // Nome de variável (índice em value; op é MINUS se negada).
         };
 
-        std::string value; //<! O valor original do Token.
+        /**
+         * @brief      Enumeração para os operadores
+         */
+        enum class operator_t : std::uint8_t
+        {
+            NONE = 0,  // Não é operador.
+            PLUS,      // "+"
+            MINUS,     // "-"
+            ASTERISK,  // "*"
+            SLASH,     // "/"
+            MOD,       // "%"
+            CARRET     // "^"
+        };
+};
+
+/**
+ * @brief      Representação de um Token cujas constantes são do tipo V
+ *
+ *             O Token é trivialmente copiável: as constantes são guardadas
+ *             em linha e os operadores por enumeração, sem nenhuma alocação
+ *             no heap.
+ */
+template < typename V >
+struct BasicToken : TokenKinds
+{
+    public:
+
+        //=== Alias
+        using value_type = V; //<! Tipo das constantes.
+
         token_t type;      //<! O tipo do Token.
+        operator_t op;     //<! O operador (se type for OPERATOR).
+        value_type value;  //<! O valor da constante (OPERAND) ou o índice da variável (VARIABLE).
+        std::uint32_t col; //<! Coluna (a partir de 1) onde o Token começa.
 
         /**
          * @brief      Construtor Default
          *
-         * @param[in]  v_    Valor do Token
          * @param[in]  t_    Tipo do Token
+         * @param[in]  op_   Operador
+         * @param[in]  v_    Valor da constante
+         * @param[in]  col_  Coluna de origem
          */
-        explicit Token( std::string v_="", token_t t_ = token_t::OPERAND )
-            : value( v_ )
-            , type( t_ )
+        constexpr explicit BasicToken( token_t t_ = token_t::OPERAND, operator_t op_ = operator_t::NONE,
+                                       value_type v_ = 0, std::uint32_t col_ = 0 )
+            : type( t_ )
+            , op( op_ )
+            , value( v_ )
+            , col( col_ )
         {/* empty */}
 
         /**
@@ -51,14 +90,33 @@ struct Token
          *
          * @return     uma ostream com a avaliação
          */
-        friend std::ostream & operator<<( std::ostream& os_, const Token & t_ )
+        friend std::ostream & operator<<( std::ostream& os_, const BasicToken & t_ )
         {
-            std::string types[] = { "OPERAND", "OPERATOR", "CLOSING SCOPE", "OPENING SCOPE" };
+            static const char * types[] = { "OPERAND", "OPERATOR", "CLOSING SCOPE", "OPENING SCOPE", "VARIABLE" };
+            static const char symbols[] = { '?', '+', '-', '*', '/', '%', '^' };
 
-            os_ << "<" << t_.value << "," << types[(int)(t_.type)] << ">";
+            os_ << "<";
+            switch ( t_.type )
+            {
+                case token_t::OPERAND       : os_ << static_cast< long long >( t_.value ); break;
+                case token_t::OPERATOR      : os_ << symbols[(int)(t_.op)]; break;
+                case token_t::CLOSING_SCOPE : os_ << ')'; break;
+                case token_t::OPENING_SCOPE : os_ << '('; break;
+                case token_t::VARIABLE      : os_ << ( t_.op == operator_t::MINUS ? "-$" : "$" )
+                                                  << static_cast< long long >( t_.value ); break;
+            }
+            os_ << "," << types[(int)(t_.type)] << ">";
 
             return os_;
         }
 };
 
+/**
+ * @brief      O Token do BARES, com constantes de 16 bits (8 bytes)
+ */
+using Token = BasicToken< std::int16_t >;
+
+static_assert( std::is_trivially_copyable< Token >::value, "Token deve ser trivialmente copiável" );
+static_assert( sizeof( Token ) == 8, "Token deve ocupar 8 bytes" );
+
 #endif
@@ -14,9 +14,48 @@
 #include <sstream>  // std::istringstream
 #include <stdexcept> //throw
 #include <string>   // std::string
+#include <string_view> // std::string_view
 #include <limits> //numeric_limits
 
 #include "token.h"  // struct Token.
+#include "arithmetic.h" // arith::unsigned_of_t
+#include "char_class.h" // CharMasks
+
+/**
+ * @brief      Representa um resultado para a operação parse
+ */
+struct ParseResult
+{
+    //=== Alias
+    typedef size_t size_type; //<! Used for column location.
+
+    //<! Lista de possíveis erros de sintaxe.
+    enum code_t {
+            OK = 0,
+            UNEXPECTED_END_OF_EXPRESSION,
+            ILL_FORMED_INTEGER,
+            MISSING_TERM,
+            EXTRANEOUS_SYMBOL,
+            MISSING_CLOSING_PARENTHESIS,
+            INTEGER_OUT_OF_RANGE,
+            TOO_MANY_VARIABLES
+    };
+
+    //=== Membros (público).
+    code_t type;      //<! Código de Erro.
+    size_type at_col; //<! Guarda a coluna do erro.
+
+    /**
+     * @brief      Construtor do Result
+     *
+     * @param[in]  type_  O tipo
+     * @param[in]  col_   A coluna de erro
+     */
+    explicit ParseResult( code_t type_=OK , size_type col_=0u )
+            : type{ type_ }
+            , at_col{ col_ }
+    { /* empty */ }
+};
 
 /*!
  * Implements a recursive descendent parser for a EBNF grammar.
@@ -27,99 +66,108 @@
  *   <natural_number>  := <digit_excl_zero>,{<digit>};
  *   <digit_excl_zero> := "1" | "2" | "3" | "4" | "5" | "6" | "7" | "8" | "9";
  *   <digit>           := "0"| <digit_excl_zero>;
+ *
+ * Com allow_variables( true ), um termo também pode ser um nome de variável:
+ *
+ *   <term>            := "(",<expr>,")" | <integer> | {"-"},<variable>;
+ *   <variable>        := <letter>,{ <letter> | <digit> };
+ *   <letter>          := "a"->"z" | "A"->"Z" | "_";
  */
 
 /**
- * @brief      Classe para Tokenizer
+ * @brief      Classe para Tokenizer, com constantes do tipo Int
+ *
+ *             Int pode ser std::int16_t, std::int32_t, std::int64_t ou
+ *             __int128 (instanciados em tokenizer.cpp). A faixa das
+ *             constantes é verificada uma única vez, sobre o módulo lido.
  */
-class Tokenizer
+template < typename Int >
+class BasicTokenizer
 {
     public:
         
-        /**
-         * @brief      Representa um resultado para a operação parse
-         */
-        struct Result
-        {
-            //=== Alias
-            typedef size_t size_type; //<! Used for column location.
-
-            //<! Lista de possíveis erros de sintaxe.
-            enum code_t {
-                    OK = 0,
-                    UNEXPECTED_END_OF_EXPRESSION,
-                    ILL_FORMED_INTEGER,
-                    MISSING_TERM,
-                    EXTRANEOUS_SYMBOL,
-                    MISSING_CLOSING_PARENTHESIS,
-                    INTEGER_OUT_OF_RANGE
-            };
-
-            //=== Membros (público).
-            code_t type;      //<! Código de Erro.
-            size_type at_col; //<! Guarda a coluna do erro.
-
-            /**
-             * @brief      Construtor do Result
-             *
-             * @param[in]  type_  O tipo
-             * @param[in]  col_   A coluna de erro
-             */
-            explicit Result( code_t type_=OK , size_type col_=0u )
-                    : type{ type_ }
-                    , at_col{ col_ }
-            { /* empty */ }
-        };
-
         //==== Aliases
-        typedef short int required_int_type;
-        typedef long long int input_int_type;
+        using Result = ParseResult;
+        using token_type = BasicToken< Int >;
+        typedef Int required_int_type;
+        typedef arith::unsigned_of_t< Int > input_int_type; //<! Módulo das constantes.
 
         //==== Public interface
         
         /**
          * @brief      Recebe uma expressão, realiza o parsing e retorna o resultado.
          *
+         *             A expressão não é copiada: ela só precisa continuar válida
+         *             durante a chamada.
+         *
          * @param[in]  e_    Expressão
          *
          * @return     Um Result sobre a expressão
          */
-        Result parse( std::string e_ );
+        Result parse( std::string_view e_ );
         
         /**
          * @brief      Pega a lista de Tokens
          *
-         * @return     A lista de Tokens
+         * @return     A lista de Tokens (válida até o próximo parse())
          */
-        std::vector< Token > get_tokens( void ) const;
+        const std::vector< token_type > & get_tokens( void ) const;
+
+        /**
+         * @brief      Aceita (ou não) nomes de variáveis nas próximas
+         *             expressões. Desligado por padrão: um nome é um erro de
+         *             sintaxe, como sempre foi.
+         *
+         *             O índice de cada nome é guardado no valor do Token: uma
+         *             expressão aceita até MAX_VARIABLES nomes distintos; o
+         *             primeiro nome além disso dá TOO_MANY_VARIABLES, na
+         *             coluna em que ele começa.
+         *
+         * @param[in]  allow_  Se os nomes são aceitos
+         */
+        void allow_variables( bool allow_ )
+        {  with_variables = allow_; }
+
+        //<! Número máximo de nomes distintos em uma expressão (índices de 0 a 32767).
+        static constexpr std::size_t MAX_VARIABLES = std::size_t( std::numeric_limits< std::int16_t >::max() ) + 1;
+
+        /**
+         * @brief      Nomes das variáveis da última expressão, na ordem em que
+         *             aparecem pela primeira vez: o Token VARIABLE guarda o
+         *             índice do nome nesta lista
+         *
+         * @return     Os nomes (válidos até o próximo parse())
+         */
+        const std::vector< std::string > & variables( void ) const
+        {  return names; }
 
         //==== Special methods
         
         /**
          * @brief      Construtor Default
          */
-        Tokenizer() = default;
+        BasicTokenizer() = default;
 
         /**
          * @brief      Destroi o objeto
          */
-        ~Tokenizer() = default;
+        ~BasicTokenizer() = default;
         
         /**
          * @brief      Construtor Cópia
          *
          * @param[in]  <unnamed>  O que se deseja copiar
          */
-        Tokenizer( const Tokenizer & ) = delete;
+        BasicTokenizer( const BasicTokenizer & ) = delete;
 
         /**
          * @brief      Operador de atribuição
          *
          * @param[in]  <unnamed>  O que se deseja atribuir
          *
-         * @return     Um Tokenizer com a atribuição
+         * @return     Um BasicTokenizer com a atribuição
          */
-        Tokenizer & operator=( const Tokenizer & ) = delete;
+        BasicTokenizer & operator=( const BasicTokenizer & ) = delete;
 
     private:
         //=== Aliases
@@ -142,14 +190,18 @@ class Tokenizer
             TS_NON_ZERO_DIGIT,   //<! "1"->"9"
             TS_WS,               //<! White-space
             TS_TAB,              //<! Tab
+            TS_LETTER,           //<! "a"->"z", "A"->"Z", "_"
             TS_EOS,              //<! End Of String
             TS_INVALID	         //<! Invalid Token
         };
 
         //==== Private members.
-        std::string expr;                //<! A expressão para ser parsed
-        std::string::iterator it_curr_symb; //<! Ponteiro para o atual char da expressão.
-        std::vector< Token > token_list; //<! Lista de Tokens final extraída da expressão.
+        std::string_view expr;           //<! A expressão para ser parsed (não copiada).
+        std::string_view::const_iterator it_curr_symb; //<! Ponteiro para o atual char da expressão.
+        std::vector< token_type > token_list; //<! Lista de Tokens final extraída da expressão.
+        CharMasks masks;                 //<! Classe de cada caractere da expressão.
+        bool with_variables = false;     //<! Se nomes de variáveis são aceitos.
+        std::vector< std::string > names; //<! Variáveis da expressão, por índice.
 
         /**
          * @brief      Converte o caractere para um dos símbolos da tabela
@@ -161,13 +213,14 @@ class Tokenizer
         terminal_symbol_t lexer( char ) const;
 
         /**
-         * @brief      converte para uma string o símbolo recebido
+         * @brief      Converte o símbolo recebido para o operador correspondente
          *
          * @param[in]  s_    O símbolo a ser convertido
          *
-         * @return     Uma string com o simbolo equivalente recebido 
+         * @return     O operador equivalente, ou TokenKinds::operator_t::NONE se
+         *             o símbolo não for um operador
          */
-        std::string token_str( terminal_symbol_t s_ ) const;
+        TokenKinds::operator_t operator_of( terminal_symbol_t s_ ) const;
 
         //=== Support methods.
         
@@ -217,13 +270,18 @@ class Tokenizer
         bool end_input( void ) const;
 
         /**
-         * @brief      Converte String para inteiro
+         * @brief      Posição (a partir de 0) do caractere atual
          *
-         * @param[in]  <unnamed>  A string a ser convertida
+         * @return     A posição
+         */
+        std::size_t position( void ) const;
+
+        /**
+         * @brief      Coluna (a partir de 1) do caractere atual
          *
-         * @return     O valor inteiro correspondente a string
+         * @return     A coluna
          */
-        input_int_type str_to_int( std::string );
+        std::uint32_t column( void ) const;
 
         //=== NTS methods.
         
@@ -241,19 +299,40 @@ class Tokenizer
          */
         Result term();
 
+        /**
+         * @brief      Verifica se o termo que começa aqui é uma variável
+         *             (nome depois de "-" e espaços opcionais)
+         *
+         * @return     True se for uma variável, False caso contrário
+         */
+        bool starts_variable( void ) const;
+
+        /**
+         * @brief      Lê uma variável e acrescenta o Token correspondente
+         *
+         * @return     Result com a variável
+         */
+        Result variable();
+
         /**
          * @brief      Verifica se é um inteiro
          *
+         * @param[out] value_     O módulo do inteiro
+         * @param[out] negative_  Se o inteiro é negativo
+         *
          * @return     Result com o inteiro
          */
-        Result integer();
+        Result integer( input_int_type & value_, bool & negative_ );
 
         /**
          * @brief      Verifica se é um núemro natural
          *
+         * @param[out] value_  O valor do número (saturado no máximo de
+         *                     input_int_type, que nunca cabe em Int)
+         *
          * @return     Result com o número natural
          */
-        Result natural_number();
+        Result natural_number( input_int_type & value_ );
 
         /**
          * @brief      Verifica se é um dígito diferente de zero
@@ -262,13 +341,11 @@ class Tokenizer
          *             False caso contrário
          */
         bool digit_excl_zero();
-
-        /**
-         * @brief      Verifica se é um dígito
-         *
-         * @return     True se for dígito, false caso contrário
-         */
-        bool digit();
 };
 
+/**
+ * @brief      O Tokenizer do BARES, com constantes de 16 bits
+ */
+using Tokenizer = BasicTokenizer< std::int16_t >;
+
 #endif
@@ -0,0 +1,135 @@
+/**
+ * @file tree_eval.h
+ * @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+ * @date 18 Outubro 2026
+ * @brief Arquivo contendo as definições da classe TreeEvaluator, que avalia
+ *        uma única expressão muito grande em paralelo.
+ */
+
+#ifndef _TREE_EVAL_H_
+#define _TREE_EVAL_H_
+
+#include <cstdint> // std::uint32_t
+#include <memory>  // std::unique_ptr
+#include <vector>  // std::vector
+
+#include "bares.h"              // Bares
+#include "work_stealing_pool.h" // WorkStealingPool, TaskGroup
+
+/**
+ * @brief      Avaliação paralela de uma expressão por redução em árvore.
+ *
+ *             A árvore é a própria forma posfixa: cada subárvore é um
+ *             intervalo contíguo dela, e um vetor guarda onde começa a
+ *             subárvore que termina em cada Token. As cadeias associadas
+ *             pela esquerda de "+"/"-" e de "*" ("a + b - c + ...") são
+ *             tratadas como um único nó com todos os operandos. Os operandos
+ *             de uma cadeia longa são divididos em segmentos avaliados em
+ *             paralelo no pool (fork-join com TaskGroup); operações isoladas
+ *             ("/", "%", "^") avaliam os dois lados em paralelo. Intervalos
+ *             pequenos são avaliados por uma única thread, com uma pilha,
+ *             como em Bares::evaluate().
+ *
+ *             O resultado é exatamente o de Bares::evaluate(), da esquerda
+ *             para a direita: em cada cadeia, uma primeira passada calcula
+ *             a soma (ou o produto) de cada segmento em 64 bits, o que dá o
+ *             valor acumulado na entrada de cada segmento; uma segunda
+ *             passada, também em paralelo, refaz cada segmento a partir
+ *             desse valor e encontra o primeiro resultado parcial fora de
+ *             int16 ou o primeiro operando com erro. Vale o evento do
+ *             primeiro segmento que tiver um, como na ordem sequencial.
+ */
+class TreeEvaluator
+{
+    public:
+        /**
+         * @brief      Cria o avaliador
+         *
+         * @param      pool_  Pool que executa as tarefas
+         */
+        explicit TreeEvaluator( WorkStealingPool & pool_ );
+
+        /**
+         * @brief      Avalia uma expressão já validada pelo Tokenizer
+         *
+         * @param[in]  infix_  Os Tokens (Tokenizer::get_tokens())
+         *
+         * @return     O mesmo resultado de Bares::evaluate( infix_ )
+         */
+        Bares::Result evaluate( const std::vector< Token > & infix_ );
+
+        //==== Métodos Especiais
+
+        /**
+         * @brief      Construtor Cópia (removido)
+         */
+        TreeEvaluator( const TreeEvaluator & ) = delete;
+
+        /**
+         * @brief      Atribuição (removida)
+         */
+        TreeEvaluator & operator=( const TreeEvaluator & ) = delete;
+
+    private:
+        /**
+         * @brief      Um operando de uma cadeia: o intervalo [first, last)
+         *             da posfixa e o operador que o liga aos anteriores
+         */
+        struct Operand
+        {
+            std::uint32_t first;    //<! Início da subárvore.
+            std::uint32_t last;     //<! Fim (exclusivo) da subárvore.
+            Token::operator_t link; //<! NONE no primeiro operando.
+        };
+
+        /**
+         * @brief      Área de trabalho de uma thread
+         */
+        struct Workspace
+        {
+            Bares bares;                              //<! Para Bares::execute().
+            std::vector< Bares::value_type > values;  //<! Pilha de eval_serial().
+        };
+
+        WorkStealingPool & pool;            //<! O pool.
+        Bares converter;                    //<! Conversão para posfixa.
+        const Token * postfix = nullptr;    //<! A forma posfixa (de converter).
+        std::vector< std::uint32_t > start; //<! Início da subárvore que termina em cada Token.
+        std::vector< std::unique_ptr< Workspace > > spaces; //<! Uma por trabalhador e uma para quem chama.
+
+        /**
+         * @brief      Avalia uma subárvore, em paralelo se ela for grande
+         *
+         * @param[in]  first_  Início da subárvore na posfixa
+         * @param[in]  last_   Fim (exclusivo) da subárvore
+         * @param[in]  depth_  Níveis de paralelismo acima deste (limita a
+         *                     recursão em árvores degeneradas)
+         *
+         * @return     O resultado da subárvore
+         */
+        Bares::Result eval( std::uint32_t first_, std::uint32_t last_, std::size_t depth_ );
+
+        /**
+         * @brief      Avalia uma subárvore em uma única thread
+         *
+         * @param[in]  first_  Início da subárvore na posfixa
+         * @param[in]  last_   Fim (exclusivo) da subárvore
+         * @param      ws_     A área de trabalho da thread atual
+         */
+        Bares::Result eval_serial( std::uint32_t first_, std::uint32_t last_, Workspace & ws_ );
+
+        /**
+         * @brief      Avalia uma cadeia longa, por segmentos em paralelo
+         *
+         * @param[in]  operands_  Os operandos da cadeia, em ordem
+         * @param[in]  depth_     Níveis de paralelismo acima deste
+         */
+        Bares::Result eval_chain( const std::vector< Operand > & operands_, std::size_t depth_ );
+
+        /**
+         * @brief      A área de trabalho da thread atual
+         */
+        Workspace & space( void );
+};
+
+#endif
@@ -0,0 +1,180 @@
+/**
+ * @file work_stealing_pool.h
+ * @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+ * @date 18 Outubro 2026
+ * @brief Arquivo contendo as definições do pool de threads com roubo de
+ *        tarefas (work stealing).
+ */
+
+#ifndef _WORK_STEALING_POOL_H_
+#define _WORK_STEALING_POOL_H_
+
+#include <atomic>             // std::atomic
+#include <condition_variable> // std::condition_variable
+#include <deque>              // std::deque
+#include <functional>         // std::function
+#include <memory>             // std::unique_ptr
+#include <mutex>              // std::mutex
+#include <thread>             // std::thread
+#include <vector>             // std::vector
+
+/**
+ * @brief      Pool de threads em que cada trabalhador tem a sua própria fila.
+ *
+ *             O dono consome o fim da sua fila (LIFO) e, quando ela esvazia,
+ *             rouba o início da fila de outro trabalhador (FIFO).
+ */
+class WorkStealingPool
+{
+    public:
+        //=== Alias
+        using task_type = std::function< void() >;
+
+        /**
+         * @brief      Cria o pool e inicia os trabalhadores
+         *
+         * @param[in]  n_workers_  Número de threads trabalhadoras (>= 1)
+         */
+        explicit WorkStealingPool( std::size_t n_workers_ );
+
+        /**
+         * @brief      Executa as tarefas pendentes e encerra os trabalhadores
+         */
+        ~WorkStealingPool();
+
+        /**
+         * @brief      Construtor Cópia (removido)
+         */
+        WorkStealingPool( const WorkStealingPool & ) = delete;
+
+        /**
+         * @brief      Atribuição (removida)
+         */
+        WorkStealingPool & operator=( const WorkStealingPool & ) = delete;
+
+        /**
+         * @brief      Enfileira uma tarefa. Se chamada por um trabalhador, vai
+         *             para a fila dele; caso contrário, as filas são
+         *             escolhidas em rodízio.
+         *
+         * @param[in]  task_  A tarefa
+         */
+        void submit( task_type task_ );
+
+        /**
+         * @brief      Número de trabalhadores
+         */
+        std::size_t size( void ) const;
+
+        /**
+         * @brief      Índice do trabalhador que executa a thread atual.
+         *
+         * @return     Um valor em [0, size()) para trabalhadores deste pool
+         *             e size() para qualquer outra thread
+         */
+        std::size_t worker_index( void ) const;
+
+        /**
+         * @brief      Executa, na thread atual, uma tarefa pendente (da
+         *             própria fila, se for um trabalhador, ou roubada de
+         *             outra). Usado por quem espera outras tarefas para
+         *             ajudar em vez de bloquear.
+         *
+         * @return     True se executou uma tarefa, False se não havia nenhuma
+         */
+        bool run_one( void );
+
+    private:
+        /**
+         * @brief      Fila de tarefas de um trabalhador
+         */
+        struct Queue
+        {
+            std::mutex m;                  //<! Protege a fila.
+            std::deque< task_type > tasks; //<! Tarefas pendentes.
+        };
+
+        std::vector< std::unique_ptr< Queue > > queues; //<! Uma fila por trabalhador.
+        std::vector< std::thread > workers;             //<! As threads trabalhadoras.
+
+        std::mutex sleep_m;                  //<! Protege a espera dos trabalhadores ociosos.
+        std::condition_variable sleep_cv;    //<! Acorda trabalhadores ociosos.
+        std::atomic< std::size_t > pending;  //<! Tarefas enfileiradas e ainda não iniciadas.
+        std::atomic< std::size_t > next_queue; //<! Rodízio de submissões externas.
+        bool stop;                           //<! Sinal de encerramento.
+
+        /**
+         * @brief      Laço principal de um trabalhador
+         *
+         * @param[in]  id_   Índice do trabalhador
+         */
+        void worker_loop( std::size_t id_ );
+
+        /**
+         * @brief      Tenta obter uma tarefa: primeiro da própria fila,
+         *             depois roubando das demais.
+         *
+         * @param[in]  id_    Índice do trabalhador
+         * @param[out] task_  A tarefa obtida
+         *
+         * @return     True se obteve uma tarefa, False caso contrário
+         */
+        bool try_pop( std::size_t id_, task_type & task_ );
+};
+
+/**
+ * @brief      Grupo de tarefas de fork-join sobre um WorkStealingPool.
+ *
+ *             wait() não bloqueia a thread: enquanto houver tarefas do
+ *             grupo em andamento, ela executa tarefas pendentes do pool.
+ *             Assim um trabalhador pode esperar as tarefas que ele mesmo
+ *             criou sem que o pool fique sem threads livres.
+ */
+class TaskGroup
+{
+    public:
+        /**
+         * @brief      Cria um grupo vazio
+         *
+         * @param      pool_  O pool que executa as tarefas
+         */
+        explicit TaskGroup( WorkStealingPool & pool_ )
+            : pool( pool_ )
+            , remaining( 0 )
+        {/* empty */}
+
+        /**
+         * @brief      Espera as tarefas que ainda estiverem em andamento
+         */
+        ~TaskGroup()
+        {  wait(); }
+
+        /**
+         * @brief      Construtor Cópia (removido)
+         */
+        TaskGroup( const TaskGroup & ) = delete;
+
+        /**
+         * @brief      Atribuição (removida)
+         */
+        TaskGroup & operator=( const TaskGroup & ) = delete;
+
+        /**
+         * @brief      Enfileira uma tarefa do grupo
+         *
+         * @param[in]  task_  A tarefa
+         */
+        void run( WorkStealingPool::task_type task_ );
+
+        /**
+         * @brief      Espera todas as tarefas do grupo, executando outras
+         *             tarefas do pool enquanto isso
+         */
+        void wait( void );
+
+    private:
+        WorkStealingPool & pool;               //<! O pool.
+        std::atomic< std::size_t > remaining;  //<! Tarefas do grupo ainda não terminadas.
+};
+
+#endif
@@ -0,0 +1,66 @@
+/**
+ * @file arena.cpp
+ * @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+ * @date 18 Outubro 2026
+ * @brief Arquivo com a implementação da arena de memória.
+ */
+
+#include "arena.h"
+
+#include <algorithm> // std::max
+
+//<! Cria a arena
+ls::Arena::Arena( std::size_t block_size_ )
+    : offset( 0 )
+    , block_size( std::max< std::size_t >( block_size_, sizeof( std::max_align_t ) ) )
+{ /* empty */ }
+
+//<! Reserva bytes alinhados
+void * ls::Arena::allocate( std::size_t bytes_, std::size_t align_ )
+{
+    std::size_t p = ( offset + align_ - 1 ) & ~( align_ - 1 );
+    if ( blocks.empty() or p + bytes_ > blocks.back().size )
+    {
+        //Blocos novos começam alinhados a max_align_t
+        grow( bytes_ );
+        p = 0;
+    }
+
+    offset = p + bytes_;
+    return reinterpret_cast< unsigned char * >( blocks.back().data.get() ) + p;
+}
+
+//<! Devolve toda a memória reservada
+void ls::Arena::rewind( void )
+{
+    offset = 0;
+    if ( blocks.size() <= 1 )
+        return;
+
+    //Junta os blocos num só, do tamanho que este ciclo precisou
+    std::size_t total = capacity();
+    blocks.clear();
+    grow( total );
+    offset = 0;
+}
+
+//<! Total de bytes em blocos
+std::size_t ls::Arena::capacity( void ) const
+{
+    std::size_t total = 0;
+    for ( const auto & b : blocks )
+        total += b.size;
+    return total;
+}
+
+//<! Acrescenta um bloco
+void ls::Arena::grow( std::size_t bytes_ )
+{
+    std::size_t size = std::max( bytes_, block_size );
+    if ( not blocks.empty() )
+        size = std::max( size, 2 * blocks.back().size );
+
+    const std::size_t cells = ( size + sizeof( std::max_align_t ) - 1 ) / sizeof( std::max_align_t );
+    blocks.push_back( Block{ std::unique_ptr< std::max_align_t[] >( new std::max_align_t[ cells ] ),
+                             cells * sizeof( std::max_align_t ) } );
+}
@@ -7,81 +7,140 @@
 
 #include "bares.h"
 
-//<! Resolve uma operação
-Bares::Result Bares::execute( std::string i_n1, std::string i_n2, Token opr){
+namespace {
+    //<! Profundidade guardada dentro da própria pilha, sem tocar na arena
+    constexpr std::size_t STACK_DEPTH = 32;
 
-    // resultado final
-    std::string fim;
+    //<! Pilha cujos elementos excedentes ficam na arena da expressão
+    template < typename T >
+    using arena_stack = ls::Stack< T, STACK_DEPTH, ls::ArenaAllocator< T > >;
+}
 
-    //converte string para inteiro
-    std::string::size_type sz;   // alias size_t
-    int n1 = std::stol (i_n1,&sz);
-    int n2 = std::stol (i_n2,&sz);
+//<! Construtor Default
+template < typename Int, typename Policy >
+BasicBares< Int, Policy >::BasicBares()
+    : arena()
+    , expression( ls::ArenaAllocator< token_type >( &arena ) )
+{ /* empty */ }
+
+//<! Descarta a expressão atual
+template < typename Int, typename Policy >
+void BasicBares< Int, Policy >::reset( void ){
+    //O vector precisa largar a memória antes que a arena a reaproveite
+    token_list( expression.get_allocator() ).swap( expression );
+    arena.rewind();
+}
+
+//<! Resolve uma operação
+template < typename Int, typename Policy >
+typename BasicBares< Int, Policy >::Result BasicBares< Int, Policy >::execute( value_type n1, value_type n2, const token_type & opr){
 
-    value_type result(0);
-    Bares::Result v;
+    //O resultado é calculado direto em Int, o que detecta exatamente
+    //quando ele sai do limite; a política decide o que fazer nesse caso.
+    Int result(0);
+    bool overflow = false;
+    bool negative = false; //<! Sinal do resultado exato, só usado para saturar.
+    Result v;
 
-    //converte o Token para const char
-    const char *d = (opr.value).c_str();
-    switch ( *d )
+    switch ( opr.op )
     {
-        case '^' : result = static_cast<value_type>( pow( n1, n2 ) );
+        case TokenKinds::operator_t::CARRET :
+                   //0 elevado a expoente negativo diverge: é erro em qualquer política
+                   if ( n1 == 0 and n2 < 0 ){
+                       v.type_b = Result::NUMERIC_OVERFLOW;
+                       return v;
+                   }
+                   if constexpr ( Policy::wraps )
+                       overflow = arith::pow_wrap( n1, n2, result );
+                   else
+                       overflow = arith::pow( n1, n2, result );
+                   negative = n1 < 0 and n2 % 2 != 0;
                    break;
-        case '*' : result =  n1 * n2;
+        case TokenKinds::operator_t::ASTERISK :
+                   overflow = arith::mul( n1, n2, result );
+                   negative = ( n1 < 0 ) != ( n2 < 0 );
                    break;
-        case '/' : if ( n2 == 0 ){
-                       v.type_b = Bares::Result::DIVISION_BY_ZERO;
+        case TokenKinds::operator_t::SLASH :
+                   if ( n2 == 0 ){
+                       v.type_b = Result::DIVISION_BY_ZERO;
                        return v;
-                   }else
-                       result = n1/n2;
+                   }
+                   overflow = arith::div( n1, n2, result );
+                   negative = ( n1 < 0 ) != ( n2 < 0 );
                    break;
-        case '%' : if ( n2 == 0 ){
-                        v.type_b = Bares::Result::DIVISION_BY_ZERO;
+        case TokenKinds::operator_t::MOD :
+                   if ( n2 == 0 ){
+                        v.type_b = Result::DIVISION_BY_ZERO;
                         return v;
-                   }else
-                       result = n1%n2;
+                   }
+                   overflow = arith::mod( n1, n2, result );
                    break;
-        case '+' : result = n1 + n2;
+        case TokenKinds::operator_t::PLUS :
+                   overflow = arith::add( n1, n2, result );
+                   negative = n2 < 0;
                    break;
-        case '-' : result =  n1 - n2;
+        case TokenKinds::operator_t::MINUS :
+                   overflow = arith::sub( n1, n2, result );
+                   negative = n2 > 0;
                    break;
         default: assert(false);
     }
 
-    //Testa se está no limite de required_int_type
-    if( result <= std::numeric_limits< Tokenizer::required_int_type >::max() 
-        and result >= std::numeric_limits< Tokenizer::required_int_type >::min()){
-
-        //converte para string
-        std::stringstream ss;
-        ss << result;
-        v.value_b = ss.str();
-        v.type_b = Bares::Result::OK;
-        
-    } else
-        v.type_b = Bares::Result::NUMERIC_OVERFLOW;
+    if ( Policy::resolve( overflow, negative, result ) )
+        v.type_b = Result::NUMERIC_OVERFLOW;
+    else
+        v.value_b = result;
 
     return v;
-        
-    
 }
 
 //<! Executa a expressão 
-Bares::Result Bares::evaluate( std::vector<Token> infix ){
+template < typename Int, typename Policy >
+typename BasicBares< Int, Policy >::Result BasicBares< Int, Policy >::evaluate( const std::vector< token_type > & infix, const Int * vars_ ){
 
     infix_to_postfix(infix);
-    ls::Stack< std::string > s;
-    Bares::Result result;
+    return run_postfix( expression.data(), expression.size(), vars_ );
+}
 
-    for( Token ch: expression){
-        if( is_operand(ch)) s.push(ch.value);
+//<! Executa uma expressão que já está em notação posfixa
+template < typename Int, typename Policy >
+typename BasicBares< Int, Policy >::Result BasicBares< Int, Policy >::evaluate_postfix( const token_type * postfix_, std::size_t size_, const Int * vars_ ){
+
+    reset();
+    return run_postfix( postfix_, size_, vars_ );
+}
+
+//<! Calcula uma expressão já em notação posfixa
+template < typename Int, typename Policy >
+typename BasicBares< Int, Policy >::Result BasicBares< Int, Policy >::run_postfix( const token_type * postfix_, std::size_t size_, const Int * vars_ ){
+
+    arena_stack< value_type > s{ ls::ArenaAllocator< value_type >( &arena ) };
+    Result result;
+
+    for( std::size_t i = 0; i < size_; ++i ){
+        const token_type & ch = postfix_[i];
+        if( is_operand(ch)) s.push( ch.value );
+
+        else if( is_variable(ch) ){
+            assert( vars_ != nullptr );
+            value_type v = vars_[ static_cast< std::size_t >( ch.value ) ];
+
+            //Variável negada: o mesmo cálculo (e overflow) de 0 - x
+            if ( ch.op == TokenKinds::operator_t::MINUS ){
+                result = execute( 0, v, token_type( TokenKinds::token_t::OPERATOR, TokenKinds::operator_t::MINUS ) );
+                if ( result.type_b != Result::OK )
+                    return result;
+                v = result.value_b;
+            }
+            s.push( v );
+        }
 
         else if( is_operator(ch) ){
             auto op2 = s.pop();
             auto op1 = s.pop();
 
             result = execute(op1, op2, ch);
-            if ( result.type_b != Bares::Result::OK )
+            if ( result.type_b != Result::OK )
                 return result;
             else
                 s.push( result.value_b );
@@ -99,50 +158,42 @@ Bares::Result Bares::evaluate( std::vector<Token> infix ){
 
 //<! Converte a expressão com notação infixa para o
 //   correspondente em representação posfixa
-void Bares::infix_to_postfix( std::vector<Token> infix_ ){
-    std::string postfix = "";
-    ls::Stack< std::string > s;
+template < typename Int, typename Policy >
+void BasicBares< Int, Policy >::infix_to_postfix( const std::vector< token_type > & infix_ ){
+    reset();
+
+    //Uma única reserva na arena para a saída
+    expression.reserve( infix_.size() );
+    arena_stack< token_type > s{ ls::ArenaAllocator< token_type >( &arena ) };
 
     //Percorre a expressão
-    for (Token ch : infix_){
+    for ( const token_type & ch : infix_ ){
 
-        if( is_operand(ch))
+        if( is_operand(ch) or is_variable(ch) )
         {
-            Token add;
-            add.type = ch.type;
-            add.value = ch.value;
-            expression.push_back(add);;
-                        
+            expression.push_back(ch);
         }
         else if ( is_operator(ch) ){
             //Remove todos os elementos com prioridade mais alta
-            while( not s.empty() and has_higher_precedence(s.top(), ch.value) ){
-
-                Token add;
-                add.type = ch.type;
-                add.value = s.pop();
-                expression.push_back(add);
+            while( not s.empty() and has_higher_precedence(s.top(), ch) ){
+                expression.push_back( s.pop() );
             }
 
             //O operador sempre entra na fila
-            s.push(ch.value);
+            s.push(ch);
         }
-        else if ( is_opening_scope(ch.value) ){
+        else if ( is_opening_scope(ch) ){
             
-            s.push(ch.value);
+            s.push(ch);
                         
         }
-        else if ( is_closing_scope(ch.value) )
+        else if ( is_closing_scope(ch) )
         {
             //Remove todos os elementos que não são '('
-            while( not is_opening_scope(s.top()) and not s.empty() )
+            while( not s.empty() and not is_opening_scope(s.top()) )
             {
                 //Vai direto para a saída
-                Token add;
-                add.type = Token::token_t::OPERATOR;
-                add.value = s.pop();
-
-                expression.push_back(add);    //Insere o novo token
+                expression.push_back( s.pop() );
             }
             s.pop(); //Remove '(' da pilha
         }
@@ -150,69 +201,75 @@ void Bares::infix_to_postfix( std::vector<Token> infix_ ){
 
    
     while (not s.empty()){
-        
-        Token add;
-        add.type = Token::token_t::OPERATOR;
-        add.value = s.pop();
-        expression.push_back(add);
+        expression.push_back( s.pop() );
     }
 
-    
+}
 
+//<! Recupera a expressão na forma posfixa
+template < typename Int, typename Policy >
+const typename BasicBares< Int, Policy >::token_list & BasicBares< Int, Policy >::postfix( void ) const{
+    return expression;
 }
 
 //<! Verifica se é operador
-bool Bares::is_operator(Token c){
+template < typename Int, typename Policy >
+bool BasicBares< Int, Policy >::is_operator( const token_type & c){
     
-    return c.type == Token::token_t::OPERATOR;
+    return c.type == TokenKinds::token_t::OPERATOR;
 }
 
 //<! Verifica se é operando
-bool Bares::is_operand( Token c){
-    return c.type == Token::token_t::OPERAND;
+template < typename Int, typename Policy >
+bool BasicBares< Int, Policy >::is_operand( const token_type & c){
+    return c.type == TokenKinds::token_t::OPERAND;
+}
+
+//<! Verifica se é variável
+template < typename Int, typename Policy >
+bool BasicBares< Int, Policy >::is_variable( const token_type & c){
+    return c.type == TokenKinds::token_t::VARIABLE;
 }
 
 //<! Verifica se é um parênteses aberto
-bool Bares::is_opening_scope( std::string c){
-    return (c == "(");
+template < typename Int, typename Policy >
+bool BasicBares< Int, Policy >::is_opening_scope( const token_type & c){
+    return c.type == TokenKinds::token_t::OPENING_SCOPE;
 }
 
 //<! Verifica se é um parênteses fechado
-bool Bares::is_closing_scope(std::string c){
-    return (c == ")");
+template < typename Int, typename Policy >
+bool BasicBares< Int, Policy >::is_closing_scope( const token_type & c){
+    return c.type == TokenKinds::token_t::CLOSING_SCOPE;
 }
 
 //<! Verifica se é associação à direita
-bool Bares::is_right_association(std::string c){
-    return c == "^";
+template < typename Int, typename Policy >
+bool BasicBares< Int, Policy >::is_right_association( const token_type & c){
+    return c.op == TokenKinds::operator_t::CARRET;
 }
 
 //<! Pega as precedências
-int Bares::get_precedence( std::string c){
+template < typename Int, typename Policy >
+int BasicBares< Int, Policy >::get_precedence( const token_type & c){
+    //'(' fica no fundo da pilha até o ')' correspondente
+    if ( is_opening_scope( c ) )
+        return 0;
+
     int weigth = 0;
-    const char *d = c.c_str();
-    switch( *d ){
-        case '^':
+    switch( c.op ){
+        case TokenKinds::operator_t::CARRET:
             weigth = 3;
             break;
-        case '*':
+        case TokenKinds::operator_t::ASTERISK:
+        case TokenKinds::operator_t::SLASH:
+        case TokenKinds::operator_t::MOD:
             weigth = 2;
             break;
-        case '/':
-            weigth = 2;
-            break;
-        case '%':
-            weigth = 2;
-            break;
-        case '+':
+        case TokenKinds::operator_t::PLUS:
+        case TokenKinds::operator_t::MINUS:
             weigth = 1;
             break;
-        case '-':
-            weigth = 1;
-            break;
-        case '(':
-            weigth = 0;
-            break;
         default:
             assert(false);
     }
@@ -221,7 +278,8 @@ int Bares::get_precedence( std::string c){
 }
 
 //<! Verifica qual a maior precedência
-bool Bares::has_higher_precedence( std::string op1, std::string op2){
+template < typename Int, typename Policy >
+bool BasicBares< Int, Policy >::has_higher_precedence( const token_type & op1, const token_type & op2){
 
     auto p1 = get_precedence( op1 ); //Top
     auto p2 = get_precedence( op2 ); //Novo operador
@@ -233,4 +291,18 @@ bool Bares::has_higher_precedence( std::string op1, std::string op2){
     
 
     return p1 >= p2;
-}
\ No newline at end of file
+}
+
+//<! Larguras e políticas suportadas
+template class BasicBares< std::int16_t, overflow::Error >;
+template class BasicBares< std::int16_t, overflow::Saturate >;
+template class BasicBares< std::int16_t, overflow::Wrap >;
+template class BasicBares< std::int32_t, overflow::Error >;
+template class BasicBares< std::int32_t, overflow::Saturate >;
+template class BasicBares< std::int32_t, overflow::Wrap >;
+template class BasicBares< std::int64_t, overflow::Error >;
+template class BasicBares< std::int64_t, overflow::Saturate >;
+template class BasicBares< std::int64_t, overflow::Wrap >;
+template class BasicBares< __int128, overflow::Error >;
+template class BasicBares< __int128, overflow::Saturate >;
+template class BasicBares< __int128, overflow::Wrap >;
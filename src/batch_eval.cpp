@@ -0,0 +1,430 @@
+/**
+ * @file batch_eval.cpp
+ * @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+ * @date 18 Outubro 2026
+ * @brief Arquivo com a implementação do avaliador em lote por formato.
+ */
+
+#include "batch_eval.h"
+
+#include <algorithm> // std::max, std::min, std::fill
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define BARES_X86 1
+#endif
+
+namespace {
+
+    //<! Valores int16 processados por instrução AVX2.
+    constexpr std::size_t LANES = BatchEvaluator::LANES;
+
+    //<! Expressões avaliadas juntas: os operandos são guardados em blocos deste tamanho.
+    constexpr std::size_t TILE = 64;
+
+    //<! Blocos com menos expressões que isto são avaliados uma a uma.
+    constexpr std::size_t MIN_VECTOR = 4;
+
+    //<! Códigos de erro, os mesmos de Bares::Result::code_t.
+    constexpr std::int16_t OK = Bares::Result::OK;
+    constexpr std::int16_t DIV_ZERO = Bares::Result::DIVISION_BY_ZERO;
+    constexpr std::int16_t OVERFLOW = Bares::Result::NUMERIC_OVERFLOW;
+
+    //<! Aplica uma instrução a n_ expressões: r_ = a_ op b_, atualizando code_.
+    using kernel_t = void (*)( const std::int16_t * a_, const std::int16_t * b_,
+                               std::int16_t * r_, std::int16_t * code_, std::size_t n_ );
+
+    //<! Uma expressão, com a mesma semântica de bc::VM::run.
+    template < bc::opcode_t OP >
+    inline std::int16_t lane( Bares::value_type n1_, Bares::value_type n2_, std::int16_t & r_ )
+    {
+        bool overflow = false;
+        switch ( OP )
+        {
+            case bc::opcode_t::ADD : overflow = arith::add( n1_, n2_, r_ ); break;
+            case bc::opcode_t::SUB : overflow = arith::sub( n1_, n2_, r_ ); break;
+            case bc::opcode_t::MUL : overflow = arith::mul( n1_, n2_, r_ ); break;
+            case bc::opcode_t::DIV : if ( n2_ == 0 ) return DIV_ZERO;
+                                     overflow = arith::narrow( n1_ / n2_, r_ ); break;
+            case bc::opcode_t::MOD : if ( n2_ == 0 ) return DIV_ZERO;
+                                     overflow = arith::narrow( n1_ % n2_, r_ ); break;
+            case bc::opcode_t::POW : overflow = arith::pow( n1_, n2_, r_ ); break;
+            default: break;
+        }
+        return overflow ? OVERFLOW : OK;
+    }
+
+    //<! Uma expressão, com a instrução escolhida em tempo de execução.
+    inline std::int16_t lane( bc::opcode_t op_, Bares::value_type n1_, Bares::value_type n2_, std::int16_t & r_ )
+    {
+        switch ( op_ )
+        {
+            case bc::opcode_t::ADD : return lane< bc::opcode_t::ADD >( n1_, n2_, r_ );
+            case bc::opcode_t::SUB : return lane< bc::opcode_t::SUB >( n1_, n2_, r_ );
+            case bc::opcode_t::MUL : return lane< bc::opcode_t::MUL >( n1_, n2_, r_ );
+            case bc::opcode_t::DIV : return lane< bc::opcode_t::DIV >( n1_, n2_, r_ );
+            case bc::opcode_t::MOD : return lane< bc::opcode_t::MOD >( n1_, n2_, r_ );
+            default                : return lane< bc::opcode_t::POW >( n1_, n2_, r_ );
+        }
+    }
+
+    //<! Versão escalar (portátil) de qualquer instrução.
+    template < bc::opcode_t OP >
+    void kernel_scalar( const std::int16_t * a_, const std::int16_t * b_,
+                        std::int16_t * r_, std::int16_t * code_, std::size_t n_ )
+    {
+        for ( std::size_t i = 0; i < n_; ++i )
+        {
+            std::int16_t r = 0;
+            std::int16_t c = lane< OP >( a_[i], b_[i], r );
+            r_[i] = r;
+            //Vale o primeiro erro de cada expressão
+            if ( code_[i] == OK )
+                code_[i] = c;
+        }
+    }
+
+#ifdef BARES_X86
+    //<! code = code ? code : ( zero ? DIV_ZERO : ( overflow ? OVERFLOW : OK ) ), sem desvios.
+    __attribute__((target("avx2")))
+    inline void update_codes( std::int16_t * code_, __m256i zero_, __m256i overflow_ )
+    {
+        __m256i * p = reinterpret_cast< __m256i * >( code_ );
+        const __m256i code = _mm256_loadu_si256( p );
+        const __m256i fresh = _mm256_or_si256( _mm256_and_si256( zero_, _mm256_set1_epi16( DIV_ZERO ) ),
+                                               _mm256_andnot_si256( zero_, _mm256_and_si256( overflow_, _mm256_set1_epi16( OVERFLOW ) ) ) );
+        const __m256i clean = _mm256_cmpeq_epi16( code, _mm256_setzero_si256() );
+        _mm256_storeu_si256( p, _mm256_or_si256( code, _mm256_and_si256( clean, fresh ) ) );
+    }
+
+    //<! Soma: overflow onde a soma truncada difere da saturada.
+    __attribute__((target("avx2")))
+    void kernel_add_avx2( const std::int16_t * a_, const std::int16_t * b_,
+                          std::int16_t * r_, std::int16_t * code_, std::size_t n_ )
+    {
+        for ( std::size_t i = 0; i < n_; i += LANES )
+        {
+            const __m256i a = _mm256_loadu_si256( reinterpret_cast< const __m256i * >( a_ + i ) );
+            const __m256i b = _mm256_loadu_si256( reinterpret_cast< const __m256i * >( b_ + i ) );
+            const __m256i r = _mm256_add_epi16( a, b );
+            const __m256i ok = _mm256_cmpeq_epi16( r, _mm256_adds_epi16( a, b ) );
+            _mm256_storeu_si256( reinterpret_cast< __m256i * >( r_ + i ), r );
+            update_codes( code_ + i, _mm256_setzero_si256(), _mm256_xor_si256( ok, _mm256_set1_epi16( -1 ) ) );
+        }
+    }
+
+    //<! Subtração: overflow onde a diferença truncada difere da saturada.
+    __attribute__((target("avx2")))
+    void kernel_sub_avx2( const std::int16_t * a_, const std::int16_t * b_,
+                          std::int16_t * r_, std::int16_t * code_, std::size_t n_ )
+    {
+        for ( std::size_t i = 0; i < n_; i += LANES )
+        {
+            const __m256i a = _mm256_loadu_si256( reinterpret_cast< const __m256i * >( a_ + i ) );
+            const __m256i b = _mm256_loadu_si256( reinterpret_cast< const __m256i * >( b_ + i ) );
+            const __m256i r = _mm256_sub_epi16( a, b );
+            const __m256i ok = _mm256_cmpeq_epi16( r, _mm256_subs_epi16( a, b ) );
+            _mm256_storeu_si256( reinterpret_cast< __m256i * >( r_ + i ), r );
+            update_codes( code_ + i, _mm256_setzero_si256(), _mm256_xor_si256( ok, _mm256_set1_epi16( -1 ) ) );
+        }
+    }
+
+    //<! Multiplicação: overflow onde a metade alta não é a extensão de sinal da baixa.
+    __attribute__((target("avx2")))
+    void kernel_mul_avx2( const std::int16_t * a_, const std::int16_t * b_,
+                          std::int16_t * r_, std::int16_t * code_, std::size_t n_ )
+    {
+        for ( std::size_t i = 0; i < n_; i += LANES )
+        {
+            const __m256i a = _mm256_loadu_si256( reinterpret_cast< const __m256i * >( a_ + i ) );
+            const __m256i b = _mm256_loadu_si256( reinterpret_cast< const __m256i * >( b_ + i ) );
+            const __m256i lo = _mm256_mullo_epi16( a, b );
+            const __m256i hi = _mm256_mulhi_epi16( a, b );
+            const __m256i ok = _mm256_cmpeq_epi16( hi, _mm256_srai_epi16( lo, 15 ) );
+            _mm256_storeu_si256( reinterpret_cast< __m256i * >( r_ + i ), lo );
+            update_codes( code_ + i, _mm256_setzero_si256(), _mm256_xor_si256( ok, _mm256_set1_epi16( -1 ) ) );
+        }
+    }
+
+    //<! Quociente truncado de 8 valores em int32, calculado em float: para
+    //   |a|, |b| <= 2^15 o erro de arredondamento (< 2^-9 / |b|) é menor que a
+    //   distância (>= 1 / |b|) entre a/b e o próximo inteiro, então é exato.
+    __attribute__((target("avx2")))
+    inline __m256i quotient8( __m256i a_, __m256i b_ )
+    {
+        return _mm256_cvttps_epi32( _mm256_div_ps( _mm256_cvtepi32_ps( a_ ), _mm256_cvtepi32_ps( b_ ) ) );
+    }
+
+    //<! Junta duas metades de 8 int32 em 16 int16 (com saturação), na ordem original.
+    __attribute__((target("avx2")))
+    inline __m256i pack16( __m256i lo_, __m256i hi_ )
+    {
+        return _mm256_permute4x64_epi64( _mm256_packs_epi32( lo_, hi_ ), 0xD8 );
+    }
+
+    //<! Divisão e resto: o divisor zero vira 1 (o resultado é descartado pelo código).
+    template < bool MOD >
+    __attribute__((target("avx2")))
+    void kernel_divmod_avx2( const std::int16_t * a_, const std::int16_t * b_,
+                             std::int16_t * r_, std::int16_t * code_, std::size_t n_ )
+    {
+        const __m256i one = _mm256_set1_epi16( 1 );
+        for ( std::size_t i = 0; i < n_; i += LANES )
+        {
+            const __m256i a = _mm256_loadu_si256( reinterpret_cast< const __m256i * >( a_ + i ) );
+            const __m256i b16 = _mm256_loadu_si256( reinterpret_cast< const __m256i * >( b_ + i ) );
+            const __m256i zero = _mm256_cmpeq_epi16( b16, _mm256_setzero_si256() );
+            const __m256i b = _mm256_blendv_epi8( b16, one, zero );
+
+            __m256i a32[2] = { _mm256_cvtepi16_epi32( _mm256_castsi256_si128( a ) ),
+                               _mm256_cvtepi16_epi32( _mm256_extracti128_si256( a, 1 ) ) };
+            __m256i b32[2] = { _mm256_cvtepi16_epi32( _mm256_castsi256_si128( b ) ),
+                               _mm256_cvtepi16_epi32( _mm256_extracti128_si256( b, 1 ) ) };
+            __m256i q[2] = { quotient8( a32[0], b32[0] ), quotient8( a32[1], b32[1] ) };
+
+            __m256i overflow = _mm256_setzero_si256();
+            __m256i r;
+            if ( MOD )
+            {
+                //a - q*b sempre cabe em int16
+                r = pack16( _mm256_sub_epi32( a32[0], _mm256_mullo_epi32( q[0], b32[0] ) ),
+                            _mm256_sub_epi32( a32[1], _mm256_mullo_epi32( q[1], b32[1] ) ) );
+            }
+            else
+            {
+                //Só -32768 / -1 = 32768 sai do intervalo
+                const __m256i limit = _mm256_set1_epi32( 32768 );
+                overflow = pack16( _mm256_cmpeq_epi32( q[0], limit ), _mm256_cmpeq_epi32( q[1], limit ) );
+                r = pack16( q[0], q[1] );
+            }
+
+            _mm256_storeu_si256( reinterpret_cast< __m256i * >( r_ + i ), r );
+            update_codes( code_ + i, zero, overflow );
+        }
+    }
+#endif
+
+    /**
+     * @brief      Versões das instruções escolhidas para a CPU
+     */
+    struct Kernels
+    {
+        kernel_t add, sub, mul, div, mod;
+    };
+
+    //<! Escolhe, uma única vez, a melhor versão suportada pela CPU.
+    Kernels select_kernels( void )
+    {
+#ifdef BARES_X86
+        __builtin_cpu_init();
+        if ( __builtin_cpu_supports( "avx2" ) )
+            return Kernels{ kernel_add_avx2, kernel_sub_avx2, kernel_mul_avx2,
+                            kernel_divmod_avx2< false >, kernel_divmod_avx2< true > };
+#endif
+        return Kernels{ kernel_scalar< bc::opcode_t::ADD >, kernel_scalar< bc::opcode_t::SUB >,
+                        kernel_scalar< bc::opcode_t::MUL >, kernel_scalar< bc::opcode_t::DIV >,
+                        kernel_scalar< bc::opcode_t::MOD > };
+    }
+
+    const Kernels kernels = select_kernels();
+}
+
+//<! Aplica uma instrução binária a n_ expressões de uma vez
+void BatchEvaluator::apply( bc::opcode_t op_, const std::int16_t * a_, const std::int16_t * b_,
+                            std::int16_t * r_, std::int16_t * code_, std::size_t n_ )
+{
+    switch ( op_ )
+    {
+        case bc::opcode_t::ADD : kernels.add( a_, b_, r_, code_, n_ ); break;
+        case bc::opcode_t::SUB : kernels.sub( a_, b_, r_, code_, n_ ); break;
+        case bc::opcode_t::MUL : kernels.mul( a_, b_, r_, code_, n_ ); break;
+        case bc::opcode_t::DIV : kernels.div( a_, b_, r_, code_, n_ ); break;
+        case bc::opcode_t::MOD : kernels.mod( a_, b_, r_, code_, n_ ); break;
+        default : kernel_scalar< bc::opcode_t::POW >( a_, b_, r_, code_, n_ ); break;
+    }
+}
+
+//<! Acrescenta uma expressão ao lote
+std::size_t BatchEvaluator::add( const Bares::token_list & postfix_ )
+{
+    //A assinatura é a sequência de instruções, sem os operandos (hash FNV-1a)
+    key.clear();
+    std::uint64_t hash = 14695981039346656037ull;
+    for ( const Token & t : postfix_ )
+    {
+        auto op = t.type == Token::token_t::OPERAND ? bc::opcode_t::PUSH : bc::opcode_of( t.op );
+        key.push_back( static_cast< char >( op ) );
+        hash = ( hash ^ static_cast< std::uint8_t >( op ) ) * 1099511628211ull;
+    }
+
+    Group & g = group_list[ find_group( hash ) ];
+    for ( const Token & t : postfix_ )
+        if ( t.type == Token::token_t::OPERAND )
+            g.literals.push_back( t.value );
+    g.members.push_back( count );
+
+    return count++;
+}
+
+//<! Encontra o grupo da assinatura em key
+std::size_t BatchEvaluator::find_group( std::uint64_t hash_ )
+{
+    if ( slots.empty() )
+        slots.assign( 64, 0 );
+
+    const std::size_t mask = slots.size() - 1;
+    std::size_t i = hash_ & mask;
+    for ( ; slots[i] != 0; i = ( i + 1 ) & mask )
+    {
+        const Group & g = group_list[ slots[i] - 1 ];
+        if ( g.hash == hash_ and g.signature == key )
+            return slots[i] - 1;
+    }
+
+    //Novo formato: reaproveita o Group (e a memória) de um lote anterior
+    std::size_t id = n_groups++;
+    if ( group_list.size() < n_groups )
+        group_list.emplace_back();
+
+    Group & g = group_list[id];
+    g.signature = key;
+    g.hash = hash_;
+    g.n_literals = 0;
+    g.max_depth = 0;
+    std::size_t depth = 0;
+    for ( char c : key )
+    {
+        if ( static_cast< bc::opcode_t >( c ) == bc::opcode_t::PUSH )
+        {
+            ++g.n_literals;
+            g.max_depth = std::max( g.max_depth, ++depth );
+        }
+        else
+            --depth;
+    }
+
+    slots[i] = static_cast< std::uint32_t >( id + 1 );
+    //Mantém a tabela com no máximo metade das posições ocupadas
+    if ( 2 * n_groups > slots.size() )
+        grow_slots();
+
+    return id;
+}
+
+//<! Dobra a tabela de grupos
+void BatchEvaluator::grow_slots( void )
+{
+    slots.assign( 2 * slots.size(), 0 );
+    const std::size_t mask = slots.size() - 1;
+    for ( std::size_t id = 0; id < n_groups; ++id )
+    {
+        std::size_t i = group_list[id].hash & mask;
+        while ( slots[i] != 0 )
+            i = ( i + 1 ) & mask;
+        slots[i] = static_cast< std::uint32_t >( id + 1 );
+    }
+}
+
+//<! Avalia todas as expressões do lote
+void BatchEvaluator::run( std::vector< Bares::Result > & results_ )
+{
+    results_.resize( count );
+    for ( std::size_t i = 0; i < n_groups; ++i )
+        run_group( group_list[i], results_ );
+}
+
+//<! Avalia um grupo
+void BatchEvaluator::run_group( const Group & g_, std::vector< Bares::Result > & results_ )
+{
+    rows.resize( g_.max_depth * TILE );
+    stack.resize( g_.max_depth );
+
+    for ( std::size_t first = 0; first < g_.members.size(); first += TILE )
+    {
+        const std::int16_t * literals = &g_.literals[ first * g_.n_literals ];
+        const std::size_t n = std::min( TILE, g_.members.size() - first );
+
+        //Poucas expressões: não compensa passar cada instrução por um bloco inteiro
+        if ( n < MIN_VECTOR )
+        {
+            for ( std::size_t m = 0; m < n; ++m )
+                results_[ g_.members[ first + m ] ] = run_one( g_, literals + m * g_.n_literals );
+            continue;
+        }
+
+        //Transpõe os operandos do bloco: a linha k tem o k-ésimo operando de
+        //todas as expressões, arredondada para o registrador (a sobra fica com 0)
+        const std::size_t lanes = ( n + LANES - 1 ) / LANES * LANES;
+        columns.assign( g_.n_literals * lanes, 0 );
+        for ( std::size_t m = 0; m < n; ++m )
+            for ( std::size_t k = 0; k < g_.n_literals; ++k )
+                columns[ k * lanes + m ] = literals[ m * g_.n_literals + k ];
+        codes.assign( lanes, OK );
+        const std::int16_t * column = columns.data();
+
+        //PUSH só empilha a linha do operando; cada operador escreve na linha da
+        //posição que o resultado ocupa na pilha
+        std::size_t sp = 0;
+        for ( char c : g_.signature )
+        {
+            auto op = static_cast< bc::opcode_t >( c );
+            if ( op == bc::opcode_t::PUSH )
+            {
+                stack[ sp ] = column;
+                column += lanes;
+                ++sp;
+                continue;
+            }
+
+            --sp;
+            const std::int16_t * a = stack[ sp - 1 ];
+            const std::int16_t * b = stack[ sp ];
+            std::int16_t * r = &rows[ ( sp - 1 ) * TILE ];
+
+            apply( op, a, b, r, codes.data(), lanes );
+            stack[ sp - 1 ] = r;
+        }
+
+        const std::int16_t * values = stack[0];
+        for ( std::size_t m = 0; m < n; ++m )
+        {
+            auto code = static_cast< Bares::Result::code_t >( codes[m] );
+            results_[ g_.members[ first + m ] ] = Bares::Result( code == OK ? values[m] : 0, code );
+        }
+    }
+}
+
+//<! Avalia uma única expressão do grupo
+Bares::Result BatchEvaluator::run_one( const Group & g_, const std::int16_t * literals_ )
+{
+    std::int16_t * sp = rows.data(); // Próxima posição livre da pilha.
+    for ( char c : g_.signature )
+    {
+        auto op = static_cast< bc::opcode_t >( c );
+        if ( op == bc::opcode_t::PUSH )
+        {
+            *sp++ = *literals_++;
+            continue;
+        }
+
+        --sp;
+        auto code = lane( op, sp[-1], sp[0], sp[-1] );
+        if ( code != OK )
+            return Bares::Result( 0, static_cast< Bares::Result::code_t >( code ) );
+    }
+
+    return Bares::Result( rows[0] );
+}
+
+//<! Esvazia o lote
+void BatchEvaluator::clear( void )
+{
+    for ( std::size_t i = 0; i < n_groups; ++i )
+    {
+        group_list[i].literals.clear();
+        group_list[i].members.clear();
+    }
+    std::fill( slots.begin(), slots.end(), 0 );
+    n_groups = 0;
+    count = 0;
+}
@@ -0,0 +1,165 @@
+/**
+ * @file bytecode.cpp
+ * @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+ * @date 18 Outubro 2026
+ * @brief Arquivo com a implementação do compilador de bytecode e da
+ *        máquina virtual.
+ */
+
+#include "bytecode.h"
+
+//<! Converte um operador para a instrução correspondente
+bc::opcode_t bc::opcode_of( Token::operator_t opr_ )
+{
+    switch ( opr_ )
+    {
+        case Token::operator_t::PLUS     : return bc::opcode_t::ADD;
+        case Token::operator_t::MINUS    : return bc::opcode_t::SUB;
+        case Token::operator_t::ASTERISK : return bc::opcode_t::MUL;
+        case Token::operator_t::SLASH    : return bc::opcode_t::DIV;
+        case Token::operator_t::MOD      : return bc::opcode_t::MOD;
+        case Token::operator_t::CARRET   : return bc::opcode_t::POW;
+        default : assert(false);
+    }
+    return bc::opcode_t::ADD;
+}
+
+//<! Compila a expressão posfixa para bytecode
+void bc::compile( const Bares::token_list & postfix_, Program & prog_ )
+{
+    prog_.clear();
+    prog_.code.reserve( postfix_.size() * 3 );
+
+    std::size_t depth = 0;
+    for ( const Token & t : postfix_ )
+    {
+        if ( t.type == Token::token_t::OPERAND )
+        {
+            //O operando vai em linha no código
+            std::int16_t value = t.value;
+            std::uint8_t raw[ sizeof( value ) ];
+            std::memcpy( raw, &value, sizeof( value ) );
+
+            prog_.code.push_back( static_cast< std::uint8_t >( opcode_t::PUSH ) );
+            prog_.code.insert( prog_.code.end(), raw, raw + sizeof( value ) );
+
+            if ( ++depth > prog_.max_depth )
+                prog_.max_depth = depth;
+        }
+        else if ( t.type == Token::token_t::VARIABLE )
+        {
+            //O índice da variável vai em linha no código
+            std::uint16_t index = static_cast< std::uint16_t >( t.value );
+            std::uint8_t raw[ sizeof( index ) ];
+            std::memcpy( raw, &index, sizeof( index ) );
+
+            prog_.code.push_back( static_cast< std::uint8_t >( opcode_t::LOAD ) );
+            prog_.code.insert( prog_.code.end(), raw, raw + sizeof( index ) );
+            if ( t.op == Token::operator_t::MINUS )
+                prog_.code.push_back( static_cast< std::uint8_t >( opcode_t::NEG ) );
+
+            if ( ++depth > prog_.max_depth )
+                prog_.max_depth = depth;
+        }
+        else
+        {
+            assert( t.type == Token::token_t::OPERATOR and depth >= 2 );
+            prog_.code.push_back( static_cast< std::uint8_t >( opcode_of( t.op ) ) );
+            --depth;
+        }
+    }
+}
+
+//<! Executa um programa compilado
+Bares::Result bc::VM::run( const Program & prog_, const Token::value_type * vars_ )
+{
+    return run( prog_.code.data(), prog_.code.size(), prog_.max_depth, vars_ );
+}
+
+//<! Executa um programa que está em outra memória
+Bares::Result bc::VM::run( const std::uint8_t * code_, std::size_t size_, std::size_t max_depth_,
+                           const Token::value_type * vars_ )
+{
+    if ( stack.size() < max_depth_ )
+        stack.resize( max_depth_ );
+
+    value_type * sp = stack.data(); // Próxima posição livre da pilha.
+    const std::uint8_t * pc  = code_;
+    const std::uint8_t * end = pc + size_;
+
+    Bares::Result v;
+    while ( pc != end )
+    {
+        auto op = static_cast< opcode_t >( *pc++ );
+        if ( op == opcode_t::PUSH )
+        {
+            std::int16_t value;
+            std::memcpy( &value, pc, sizeof( value ) );
+            pc += sizeof( value );
+            *sp++ = value;
+            continue;
+        }
+        if ( op == opcode_t::LOAD )
+        {
+            std::uint16_t index;
+            std::memcpy( &index, pc, sizeof( index ) );
+            pc += sizeof( index );
+            *sp++ = vars_[ index ];
+            continue;
+        }
+        if ( op == opcode_t::NEG )
+        {
+            Tokenizer::required_int_type result(0);
+            if ( arith::sub( value_type( 0 ), sp[-1], result ) )
+            {
+                v.type_b = Bares::Result::NUMERIC_OVERFLOW;
+                return v;
+            }
+            sp[-1] = result;
+            continue;
+        }
+
+        value_type n2 = *--sp;
+        value_type n1 = sp[-1];
+        Tokenizer::required_int_type result(0);
+        bool overflow = false;
+
+        switch ( op )
+        {
+            case opcode_t::POW : overflow = arith::pow( n1, n2, result );
+                                 break;
+            case opcode_t::MUL : overflow = arith::mul( n1, n2, result );
+                                 break;
+            case opcode_t::DIV : if ( n2 == 0 ){
+                                     v.type_b = Bares::Result::DIVISION_BY_ZERO;
+                                     return v;
+                                 }
+                                 overflow = arith::narrow( n1 / n2, result );
+                                 break;
+            case opcode_t::MOD : if ( n2 == 0 ){
+                                     v.type_b = Bares::Result::DIVISION_BY_ZERO;
+                                     return v;
+                                 }
+                                 overflow = arith::narrow( n1 % n2, result );
+                                 break;
+            case opcode_t::ADD : overflow = arith::add( n1, n2, result );
+                                 break;
+            case opcode_t::SUB : overflow = arith::sub( n1, n2, result );
+                                 break;
+            default: assert(false);
+        }
+
+        if ( overflow )
+        {
+            v.type_b = Bares::Result::NUMERIC_OVERFLOW;
+            return v;
+        }
+
+        sp[-1] = result;
+    }
+
+    v.value_b = sp[-1];
+    v.type_b = Bares::Result::OK;
+
+    return v;
+}
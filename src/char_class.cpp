@@ -0,0 +1,182 @@
+/**
+ * @file char_class.cpp
+ * @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+ * @date 18 Outubro 2026
+ * @brief Arquivo com a implementação da classificação vetorizada de
+ *        caracteres.
+ */
+
+#include "char_class.h"
+
+#include <algorithm> // std::min
+#include <cstring>   // std::memcpy
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define BARES_X86 1
+#endif
+
+namespace {
+
+    //<! Índices das máscaras produzidas por bloco de 64 bytes.
+    enum { DIGIT = 0, OP, PAREN, WS };
+
+    //<! Tipo das funções que classificam um bloco de 64 bytes.
+    using kernel_t = void (*)( const char *, std::uint64_t * );
+
+    //<! Classificação escalar por tabela (versão portátil).
+    void classify64_scalar( const char * p_, std::uint64_t * out_ )
+    {
+        out_[DIGIT] = out_[OP] = out_[PAREN] = out_[WS] = 0;
+        for ( unsigned i = 0; i < 64; ++i )
+        {
+            std::uint64_t bit = std::uint64_t(1) << i;
+            switch ( p_[i] )
+            {
+                case '0': case '1': case '2': case '3': case '4':
+                case '5': case '6': case '7': case '8': case '9':
+                    out_[DIGIT] |= bit; break;
+                case '+': case '-': case '*': case '/': case '%': case '^':
+                    out_[OP] |= bit; break;
+                case '(': case ')':
+                    out_[PAREN] |= bit; break;
+                case ' ': case '\t':
+                    out_[WS] |= bit; break;
+                default: break;
+            }
+        }
+    }
+
+#ifdef BARES_X86
+    //<! Classifica 16 bytes com SSE2.
+    inline void classify16_sse2( const char * p_, std::uint32_t * m_ )
+    {
+        const __m128i x = _mm_loadu_si128( reinterpret_cast< const __m128i * >( p_ ) );
+        auto eq = [&x]( char c ){ return _mm_cmpeq_epi8( x, _mm_set1_epi8( c ) ); };
+
+        // (x - '0') <= 9 sem sinal
+        const __m128i d = _mm_sub_epi8( x, _mm_set1_epi8( '0' ) );
+        const __m128i digit = _mm_cmpeq_epi8( _mm_min_epu8( d, _mm_set1_epi8( 9 ) ), d );
+        const __m128i op = _mm_or_si128( _mm_or_si128( _mm_or_si128( eq('+'), eq('-') ),
+                                                       _mm_or_si128( eq('*'), eq('/') ) ),
+                                         _mm_or_si128( eq('%'), eq('^') ) );
+        const __m128i paren = _mm_or_si128( eq('('), eq(')') );
+        const __m128i ws = _mm_or_si128( eq(' '), eq('\t') );
+
+        m_[DIGIT] = static_cast< std::uint32_t >( _mm_movemask_epi8( digit ) );
+        m_[OP]    = static_cast< std::uint32_t >( _mm_movemask_epi8( op ) );
+        m_[PAREN] = static_cast< std::uint32_t >( _mm_movemask_epi8( paren ) );
+        m_[WS]    = static_cast< std::uint32_t >( _mm_movemask_epi8( ws ) );
+    }
+
+    //<! Classifica um bloco de 64 bytes com SSE2.
+    void classify64_sse2( const char * p_, std::uint64_t * out_ )
+    {
+        out_[DIGIT] = out_[OP] = out_[PAREN] = out_[WS] = 0;
+        for ( unsigned k = 0; k < 4; ++k )
+        {
+            std::uint32_t m[4];
+            classify16_sse2( p_ + 16 * k, m );
+            for ( unsigned c = 0; c < 4; ++c )
+                out_[c] |= std::uint64_t( m[c] ) << ( 16 * k );
+        }
+    }
+
+    //<! Compara os 32 bytes com o caractere c.
+    __attribute__((target("avx2")))
+    inline __m256i eq_avx2( __m256i x_, char c_ )
+    {  return _mm256_cmpeq_epi8( x_, _mm256_set1_epi8( c_ ) ); }
+
+    //<! Classifica 32 bytes com AVX2.
+    __attribute__((target("avx2")))
+    inline void classify32_avx2( const char * p_, std::uint32_t * m_ )
+    {
+        const __m256i x = _mm256_loadu_si256( reinterpret_cast< const __m256i * >( p_ ) );
+
+        const __m256i d = _mm256_sub_epi8( x, _mm256_set1_epi8( '0' ) );
+        const __m256i digit = _mm256_cmpeq_epi8( _mm256_min_epu8( d, _mm256_set1_epi8( 9 ) ), d );
+        const __m256i op = _mm256_or_si256( _mm256_or_si256( _mm256_or_si256( eq_avx2( x, '+' ), eq_avx2( x, '-' ) ),
+                                                             _mm256_or_si256( eq_avx2( x, '*' ), eq_avx2( x, '/' ) ) ),
+                                            _mm256_or_si256( eq_avx2( x, '%' ), eq_avx2( x, '^' ) ) );
+        const __m256i paren = _mm256_or_si256( eq_avx2( x, '(' ), eq_avx2( x, ')' ) );
+        const __m256i ws = _mm256_or_si256( eq_avx2( x, ' ' ), eq_avx2( x, '\t' ) );
+
+        m_[DIGIT] = static_cast< std::uint32_t >( _mm256_movemask_epi8( digit ) );
+        m_[OP]    = static_cast< std::uint32_t >( _mm256_movemask_epi8( op ) );
+        m_[PAREN] = static_cast< std::uint32_t >( _mm256_movemask_epi8( paren ) );
+        m_[WS]    = static_cast< std::uint32_t >( _mm256_movemask_epi8( ws ) );
+    }
+
+    //<! Classifica um bloco de 64 bytes com AVX2.
+    __attribute__((target("avx2")))
+    void classify64_avx2( const char * p_, std::uint64_t * out_ )
+    {
+        std::uint32_t lo[4], hi[4];
+        classify32_avx2( p_, lo );
+        classify32_avx2( p_ + 32, hi );
+        for ( unsigned c = 0; c < 4; ++c )
+            out_[c] = std::uint64_t( lo[c] ) | ( std::uint64_t( hi[c] ) << 32 );
+    }
+#endif
+
+    //<! Escolhe, uma única vez, a melhor versão suportada pela CPU.
+    kernel_t select_kernel( void )
+    {
+#ifdef BARES_X86
+        __builtin_cpu_init();
+        if ( __builtin_cpu_supports( "avx2" ) )
+            return classify64_avx2;
+        if ( __builtin_cpu_supports( "sse2" ) )
+            return classify64_sse2;
+#endif
+        return classify64_scalar;
+    }
+
+    const kernel_t classify64 = select_kernel();
+}
+
+//<! Classifica todos os caracteres da expressão
+void CharMasks::classify( std::string_view s_ )
+{
+    size = s_.size();
+    const std::size_t words = ( size + 63 ) / 64;
+    digit.resize( words );
+    op.resize( words );
+    paren.resize( words );
+    ws.resize( words );
+
+    std::uint64_t m[4];
+    std::size_t k = 0;
+    for ( ; 64 * ( k + 1 ) <= size; ++k )
+    {
+        classify64( s_.data() + 64 * k, m );
+        digit[k] = m[DIGIT]; op[k] = m[OP]; paren[k] = m[PAREN]; ws[k] = m[WS];
+    }
+
+    //Bloco final incompleto: completado com zeros, que não pertencem a nenhuma classe
+    if ( k < words )
+    {
+        char tail[64] = {};
+        std::memcpy( tail, s_.data() + 64 * k, size - 64 * k );
+        classify64( tail, m );
+        digit[k] = m[DIGIT]; op[k] = m[OP]; paren[k] = m[PAREN]; ws[k] = m[WS];
+    }
+}
+
+//<! Primeira posição a partir de pos_ cujo bit está zerado
+std::size_t CharMasks::next_clear( const std::vector< std::uint64_t > & m_, std::size_t pos_ ) const
+{
+    if ( pos_ >= size )
+        return size;
+
+    std::size_t k = pos_ >> 6;
+    std::uint64_t w = ~m_[k] & ( ~std::uint64_t(0) << ( pos_ & 63 ) );
+    while ( w == 0 )
+    {
+        if ( ++k == m_.size() )
+            return size;
+        w = ~m_[k];
+    }
+
+    return std::min( size, ( k << 6 ) + static_cast< std::size_t >( __builtin_ctzll( w ) ) );
+}
@@ -0,0 +1,194 @@
+/**
+ * @file compiled_file.cpp
+ * @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+ * @date 18 Outubro 2026
+ * @brief Arquivo com a implementação do formato binário de expressões
+ *        compiladas.
+ */
+
+#include "compiled_file.h"
+
+#include <algorithm> // std::max
+#include <cstring>   // std::memcmp, std::memcpy
+#include <fstream>   // std::ofstream
+#include <stdexcept> // std::runtime_error
+
+namespace {
+
+    /**
+     * @brief      Hash FNV-1a sobre palavras de 64 bits (e os bytes finais)
+     *
+     * @param[in]  data_  Os bytes
+     * @param[in]  size_  Quantidade de bytes
+     * @param[in]  h_     Hash acumulado até aqui
+     *
+     * @return     O novo hash
+     */
+    std::uint64_t checksum( const void * data_, std::size_t size_,
+                            std::uint64_t h_ = 1469598103934665603ull )
+    {
+        constexpr std::uint64_t PRIME = 1099511628211ull;
+        const auto * p = static_cast< const std::uint8_t * >( data_ );
+
+        for ( ; size_ >= 8; size_ -= 8, p += 8 )
+        {
+            std::uint64_t w;
+            std::memcpy( &w, p, 8 );
+            h_ = ( h_ ^ w ) * PRIME;
+        }
+        for ( ; size_ > 0; --size_, ++p )
+            h_ = ( h_ ^ *p ) * PRIME;
+
+        return h_;
+    }
+
+    //<! Erro de formato do arquivo
+    std::runtime_error bad_file( const std::string & path_, const char * why_ )
+    {  return std::runtime_error( "CompiledFile: " + path_ + ": " + why_ ); }
+
+    /**
+     * @brief      Confere um programa antes de entregá-lo à VM, que não faz
+     *             nenhuma verificação: instruções conhecidas, operandos
+     *             dentro do programa, nenhuma variável (o modo pré-compilado
+     *             não tem valores para LOAD) e uma pilha que nunca fica com
+     *             menos valores que a instrução consome e termina com
+     *             exatamente um valor. A profundidade máxima simulada precisa
+     *             ser igual a max_depth, que a VM usa para alocar a pilha.
+     *
+     * @param[in]  code_       Início das instruções
+     * @param[in]  size_       Bytes das instruções
+     * @param[in]  max_depth_  Profundidade máxima declarada
+     *
+     * @return     True se o programa pode ser executado com segurança
+     */
+    bool valid_program( const std::uint8_t * code_, std::size_t size_, std::size_t max_depth_ )
+    {
+        using bc::opcode_t;
+
+        std::size_t depth = 0, peak = 0;
+        for ( std::size_t pc = 0; pc < size_; )
+        {
+            switch ( static_cast< opcode_t >( code_[ pc++ ] ) )
+            {
+                case opcode_t::PUSH : if ( size_ - pc < sizeof( std::int16_t ) or ++depth > max_depth_ )
+                                          return false;
+                                      pc += sizeof( std::int16_t );
+                                      peak = std::max( peak, depth );
+                                      break;
+                case opcode_t::NEG  : if ( depth < 1 )
+                                          return false;
+                                      break;
+                case opcode_t::ADD  :
+                case opcode_t::SUB  :
+                case opcode_t::MUL  :
+                case opcode_t::DIV  :
+                case opcode_t::MOD  :
+                case opcode_t::POW  : if ( depth < 2 )
+                                          return false;
+                                      --depth;
+                                      break;
+                default             : return false; // LOAD ou instrução desconhecida
+            }
+        }
+
+        return depth == 1 and peak == max_depth_;
+    }
+}
+
+//<! Acrescenta uma expressão válida
+void bc::FileWriter::add( const Program & prog_ )
+{
+    FileEntry e{};
+    e.offset = code.size();
+    e.size = static_cast< std::uint32_t >( prog_.code.size() );
+    e.max_depth = static_cast< std::uint32_t >( prog_.max_depth );
+    e.kind = FileEntry::PROGRAM;
+    entries.push_back( e );
+
+    code.insert( code.end(), prog_.code.begin(), prog_.code.end() );
+}
+
+//<! Acrescenta uma linha com erro de parsing
+void bc::FileWriter::add_error( const Tokenizer::Result & result_ )
+{
+    FileEntry e{};
+    e.offset = code.size();
+    e.column = static_cast< std::uint32_t >( result_.at_col );
+    e.kind = FileEntry::PARSE_ERROR;
+    e.code = static_cast< std::uint8_t >( result_.type );
+    entries.push_back( e );
+}
+
+//<! Grava o arquivo
+void bc::FileWriter::save( const std::string & path_ ) const
+{
+    FileHeader h{};
+    std::memcpy( h.magic, FILE_MAGIC, sizeof( h.magic ) );
+    h.version = FILE_VERSION;
+    h.value_bytes = sizeof( std::int16_t );
+    h.count = entries.size();
+    h.code_size = code.size();
+    //A tabela tem múltiplo de 8 bytes: o hash em duas partes é o mesmo do arquivo contínuo
+    h.checksum = checksum( code.data(), code.size(),
+                           checksum( entries.data(), entries.size() * sizeof( FileEntry ) ) );
+
+    std::ofstream out( path_, std::ios::binary | std::ios::trunc );
+    out.write( reinterpret_cast< const char * >( &h ), sizeof( h ) );
+    out.write( reinterpret_cast< const char * >( entries.data() ), entries.size() * sizeof( FileEntry ) );
+    out.write( reinterpret_cast< const char * >( code.data() ), code.size() );
+    out.close();
+
+    if ( not out )
+        throw std::runtime_error( "FileWriter: " + path_ + ": falha na gravação" );
+}
+
+//<! Mapeia e confere o arquivo
+bc::CompiledFile::CompiledFile( const std::string & path_ )
+    : file( path_ )
+    , count( 0 )
+    , table( nullptr )
+    , code( nullptr )
+{
+    std::string_view bytes = file.view();
+    if ( bytes.size() < sizeof( FileHeader ) )
+        throw bad_file( path_, "arquivo pequeno demais" );
+
+    FileHeader h;
+    std::memcpy( &h, bytes.data(), sizeof( h ) );
+    if ( std::memcmp( h.magic, FILE_MAGIC, sizeof( h.magic ) ) != 0 )
+        throw bad_file( path_, "não é um arquivo compilado" );
+    if ( h.version != FILE_VERSION or h.value_bytes != sizeof( std::int16_t ) )
+        throw bad_file( path_, "versão incompatível (compile novamente)" );
+
+    //Tamanhos conferidos sem overflow
+    const std::size_t body = bytes.size() - sizeof( FileHeader );
+    if ( h.count > body / sizeof( FileEntry )
+         or h.code_size != body - h.count * sizeof( FileEntry ) )
+        throw bad_file( path_, "tamanho inconsistente" );
+
+    const char * base = bytes.data() + sizeof( FileHeader );
+    if ( checksum( base, body ) != h.checksum )
+        throw bad_file( path_, "checksum inválido" );
+
+    count = static_cast< std::size_t >( h.count );
+    table = reinterpret_cast< const FileEntry * >( base );
+    code = reinterpret_cast< const std::uint8_t * >( base + count * sizeof( FileEntry ) );
+
+    //Cada entrada é conferida uma única vez aqui, e não a cada execução
+    for ( std::size_t i = 0; i < count; ++i )
+    {
+        const FileEntry & e = table[i];
+        if ( e.kind == FileEntry::PARSE_ERROR )
+        {
+            if ( e.code == Tokenizer::Result::OK or e.code > Tokenizer::Result::TOO_MANY_VARIABLES )
+                throw bad_file( path_, "código de erro inválido" );
+            continue;
+        }
+        if ( e.kind != FileEntry::PROGRAM )
+            throw bad_file( path_, "tipo de entrada desconhecido" );
+        if ( e.offset > h.code_size or e.size > h.code_size - e.offset )
+            throw bad_file( path_, "entrada fora da área de código" );
+        if ( not valid_program( code + e.offset, e.size, e.max_depth ) )
+            throw bad_file( path_, "programa inválido" );
+    }
+}
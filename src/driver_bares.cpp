@@ -14,118 +14,863 @@
  * Any other character is just ignored.
  */
 
+#include <algorithm> // std::max, std::find
 #include <iostream>  // cout, endl
 #include <sstream>   // getline
-#include <stack>     // stack
 #include <string>    // string
-#include <iomanip>   //setfill, setw
+#include <cstring>   // strcmp
+#include <thread>    // std::thread
+#include <memory>    // std::unique_ptr
+#include <csignal>   // sigaction
+#include <charconv>  // std::from_chars
+#include <unistd.h>  // STDIN_FILENO
 
-#include "tokenizer.h"
-#include "bares.h"
+#include "evaluator.h"
+#include "work_stealing_pool.h"
+#include "reorder_buffer.h"
+#include "stream_pipeline.h"
+#include "mapped_file.h"
+#include "batch_eval.h"
+#include "server.h"
+#include "compiled_file.h"
+#include "incremental.h"
+#include "formula.h"
+#include "tree_eval.h"
+#include "parallel_tokenizer.h"
 
-using value_type = long int;
+//<! Número de linhas avaliadas por tarefa no modo em lote.
+static constexpr std::size_t LINES_PER_CHUNK = 512;
+//<! Blocos em trânsito por trabalhador no modo em lote.
+static constexpr std::size_t CHUNKS_PER_WORKER = 8;
+//<! Linhas agrupadas por formato de uma só vez no modo vetorizado.
+static constexpr std::size_t LINES_PER_BATCH = 1 << 16;
 
 /**
- * @brief      Imprime menssagens de erro do Bares
+ * @brief      Escreve o que restar da saída padrão
  *
- * @param[in]  result  O Resultado do bares
+ * @param      out   O escritor da saída
+ *
+ * @return     EXIT_FAILURE (com uma mensagem) se alguma escrita falhou
+ */
+static int finish_output( OutputWriter & out )
+{
+    if ( out.flush() )
+        return EXIT_SUCCESS;
+    std::cerr << "Erro ao escrever a saída\n";
+    return EXIT_FAILURE;
+}
+
+/**
+ * @brief      Modo sequencial: lê todas as linhas e as avalia em ordem
+ *
+ * @param[in]  options  Opções de avaliação
+ *
+ * @return     Execução terminada
  */
-void print_msg_bares ( const Bares::Result & result)
+int run_sequential( const EvalOptions & options )
 {
-    switch ( result.type_b )
+    //lista com as expressões
+    std::vector<std::string> expressions;
+    std::string aux;
+
+    while ( std::getline(std::cin, aux) )
     {
-        case Bares::Result::DIVISION_BY_ZERO:
-            std::cout << "Divisão por zero!\n";
-            break;
-        case Bares::Result::NUMERIC_OVERFLOW:
-            std::cout << "Erro de sobrecarga numérica!\n";
-            break;
-        default:
-            std::cout << "Erro sem tratamento!\n";
-            break;
+        expressions.push_back( aux );
+    }
+
+    Evaluator evaluator( options ); // Instancia um parser e a máquina virtual.
+    OutputWriter out( options.output, STDOUT_FILENO );
+    // Tentar analisar cada expressão da lista.
+    for( const auto & expr : expressions )
+    {
+        evaluator.eval( expr, out );
     }
+
+    return finish_output( out );
 }
 
 /**
- * @brief      Imprime menssagens de erro do Tokenizer
+ * @brief      Modo em lote: as linhas são agrupadas em blocos avaliados por
+ *             um pool de threads e a saída é escrita na ordem de entrada.
+ *
+ * @param[in]  n_threads  Número de threads trabalhadoras
+ * @param[in]  options    Opções de avaliação
  *
- * @param[in]  result  The resultado do Tokenizer
- * @param[in]  str     A string da posição do erro
+ * @return     Execução terminada
  */
-void print_msg( const Tokenizer::Result & result)
+int run_threaded( std::size_t n_threads, const EvalOptions & options )
 {
-    //std::string error_indicator( str.size(), ' ');
+    const std::size_t n_workers = std::max< std::size_t >( n_threads, 1 );
+    ReorderBuffer reorder( n_workers * CHUNKS_PER_WORKER );
+
+    // Um par Tokenizer/VM por trabalhador.
+    std::vector< std::unique_ptr< Evaluator > > evaluators;
+    for ( std::size_t i = 0; i < n_workers; ++i )
+        evaluators.emplace_back( new Evaluator( options ) );
+
+    // Declarado por último: o pool é destruído (e os trabalhadores terminam
+    // a última chamada a reorder.put) antes de reorder e evaluators.
+    WorkStealingPool pool( n_workers );
+
+    // Escreve os blocos assim que ficarem prontos, na ordem de entrada.
+    int status = EXIT_SUCCESS;
+    std::thread writer( [&reorder, &options, &status]{
+        OutputWriter out( options.output, STDOUT_FILENO );
+        std::string block;
+        while ( reorder.pop( block ) )
+            out.raw( block );
+        status = finish_output( out );
+    });
 
-    // Have we got a parsing error?
-    //error_indicator[result.at_col -1] = '^';
-    switch ( result.type )
+    std::size_t seq = 0;
+    auto dispatch = [&]( std::vector< std::string > && lines ){
+        reorder.wait_for_slot( seq );
+        auto chunk = std::make_shared< std::vector< std::string > >( std::move( lines ) );
+        std::size_t id = seq++;
+        pool.submit( [&pool, &evaluators, &reorder, &options, chunk, id]{
+            Evaluator & ev = *evaluators[ pool.worker_index() ];
+            OutputWriter out( options.output );
+            for ( const auto & expr : *chunk )
+                ev.eval( expr, out );
+            reorder.put( id, std::string( out.view() ) );
+        });
+    };
+
+    std::vector< std::string > lines;
+    lines.reserve( LINES_PER_CHUNK );
+    std::string aux;
+    while ( std::getline( std::cin, aux ) )
     {
-        case Tokenizer::Result::UNEXPECTED_END_OF_EXPRESSION:
-            std::cout << "Final inesperado de expressão na coluna (" << result.at_col << ")!\n";
-            break;
-        case Tokenizer::Result::ILL_FORMED_INTEGER:
-            std::cout << "Inteiro mal formado na coluna (" << result.at_col << ")!\n";
-            break;
-        case Tokenizer::Result::MISSING_TERM:
-            std::cout << "Faltando <termo> na coluna (" << result.at_col << ")!\n";
-            break;
-        case Tokenizer::Result::EXTRANEOUS_SYMBOL:
-            std::cout << "Símbolo inesperado após expressão válida encontrado na coluna (" << result.at_col << ")!\n";
-            break;
-        case Tokenizer::Result::MISSING_CLOSING_PARENTHESIS:
-            std::cout << "Faltando símbolo \")\" na coluna (" << result.at_col << ")!\n";
-            break;
-        case Tokenizer::Result::INTEGER_OUT_OF_RANGE:
-            std::cout << "Constante inteira fora do intervalo começando na coluna (" << result.at_col << ")!\n";
-            break;
-        default:
-            std::cout << "Erro sem tratamento!\n";
+        lines.push_back( std::move( aux ) );
+        if ( lines.size() == LINES_PER_CHUNK )
+        {
+            dispatch( std::move( lines ) );
+            lines.clear();
+            lines.reserve( LINES_PER_CHUNK );
+        }
+    }
+    if ( not lines.empty() )
+        dispatch( std::move( lines ) );
+
+    reorder.finish( seq );
+    writer.join();
+
+    return status;
+}
+
+/**
+ * @brief      Modo vetorizado: blocos de linhas são agrupados pelo formato
+ *             da expressão e cada grupo é avaliado de uma só vez
+ *             (BatchEvaluator); a saída é escrita na ordem de entrada
+ *
+ * @param[in]  options  Opções de avaliação (apenas as estatísticas)
+ *
+ * @return     Execução terminada
+ */
+int run_batch( const EvalOptions & options )
+{
+    Tokenizer parser;
+    Bares bares;
+    BatchEvaluator batch;
+    stats::Counters * counters = options.stats ? options.stats->add() : nullptr;
+
+    std::vector< std::string > lines;
+    std::vector< Tokenizer::Result > parsed; // Resultado do parsing de cada linha.
+    std::vector< Bares::Result > results;    // Resultado das linhas válidas, na ordem.
+    std::string aux;
+    bool more = true;
+    OutputWriter out( options.output, STDOUT_FILENO );
+
+    while ( more )
+    {
+        lines.clear();
+        while ( lines.size() < LINES_PER_BATCH and ( more = bool( std::getline( std::cin, aux ) ) ) )
+            lines.push_back( std::move( aux ) );
+
+        parsed.clear();
+        batch.clear();
+        for ( const auto & expr : lines )
+        {
+            parsed.push_back( parser.parse( expr ) );
+            if ( counters )
+                counters->parsed( parsed.back().type, parser.get_tokens().size() );
+            if ( parsed.back().type != Tokenizer::Result::OK )
+                continue;
+
+            bares.infix_to_postfix( parser.get_tokens() );
+            batch.add( bares.postfix() );
+        }
+
+        batch.run( results );
+
+        std::size_t next = 0;
+        for ( const auto & r : parsed )
+        {
+            if ( r.type != Tokenizer::Result::OK )
+            {
+                out.parse_error( r );
+                continue;
+            }
+
+            const Bares::Result & v = results[ next++ ];
+            if ( counters )
+                counters->evaluated( v.type_b );
+            out.result( v );
+        }
+    }
+
+    return finish_output( out );
+}
+
+/**
+ * @brief      Modo em fluxo: avalia a entrada padrão à medida que ela chega,
+ *             com memória limitada
+ *
+ * @param[in]  options  Opções de avaliação
+ *
+ * @return     Execução terminada
+ */
+int run_stream( const EvalOptions & options )
+{
+    StreamPipeline pipeline( STDIN_FILENO, std::cout, options );
+    return pipeline.run() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/**
+ * @brief      Modo mapeado: o arquivo é mapeado em memória e cada linha é
+ *             entregue ao parser como uma visão, sem cópias
+ *
+ * @param[in]  path     Caminho do arquivo de entrada
+ * @param[in]  options  Opções de avaliação
+ *
+ * @return     Execução terminada
+ */
+int run_mapped( const std::string & path, const EvalOptions & options )
+{
+    MappedFile file( path );
+    std::string_view content = file.view();
+
+    Evaluator evaluator( options );
+    OutputWriter out( options.output, STDOUT_FILENO );
+    while ( not content.empty() )
+    {
+        auto nl = content.find( '\n' );
+        std::string_view line = content.substr( 0, nl );
+        evaluator.eval( line, out );
+
+        if ( nl == std::string_view::npos )
             break;
+        content.remove_prefix( nl + 1 );
     }
+
+    return finish_output( out );
 }
 
 /**
- * @brief      Programa principal
+ * @brief      Modo de compilação: grava os programas (e os erros de parsing)
+ *             de todas as linhas em um arquivo compilado
+ *
+ * @param[in]  path     Caminho do arquivo compilado
+ * @param[in]  options  Opções de avaliação (apenas as estatísticas)
  *
  * @return     Execução terminada
  */
-int main()
+int run_compile( const std::string & path, const EvalOptions & options )
 {
-    //lista com as expressões
-    std::vector<std::string> expressions;
+    Tokenizer parser;
+    Bares bares;
+    bc::Program program;
+    bc::FileWriter file;
+    stats::Counters * counters = options.stats ? options.stats->add() : nullptr;
+
     std::string aux;
+    while ( std::getline( std::cin, aux ) )
+    {
+        auto result = parser.parse( aux );
+        if ( counters )
+            counters->parsed( result.type, parser.get_tokens().size() );
+        if ( result.type != Tokenizer::Result::OK )
+        {
+            file.add_error( result );
+            continue;
+        }
 
-    while ( std::getline(std::cin, aux) )
+        bares.infix_to_postfix( parser.get_tokens() );
+        bc::compile( bares.postfix(), program );
+        file.add( program );
+    }
+
+    file.save( path );
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief      Modo pré-compilado: mapeia um arquivo de --compile e apenas
+ *             executa os programas
+ *
+ * @param[in]  path     Caminho do arquivo compilado
+ * @param[in]  options  Opções de avaliação (formato e estatísticas)
+ *
+ * @return     Execução terminada
+ */
+int run_compiled( const std::string & path, const EvalOptions & options )
+{
+    bc::CompiledFile file( path );
+    bc::VM vm;
+    OutputWriter out( options.output, STDOUT_FILENO );
+    stats::Counters * counters = options.stats ? options.stats->add() : nullptr;
+
+    for ( std::size_t i = 0; i < file.size(); ++i )
     {
-        expressions.push_back( aux );
+        const bc::FileEntry & e = file.entry( i );
+        const auto code = e.kind == bc::FileEntry::PARSE_ERROR
+                        ? static_cast< Tokenizer::Result::code_t >( e.code ) : Tokenizer::Result::OK;
+        //O arquivo não guarda o número de Tokens
+        if ( counters )
+            counters->parsed( code, 0 );
+        if ( code != Tokenizer::Result::OK )
+        {
+            out.parse_error( Tokenizer::Result( code, e.column ) );
+            continue;
+        }
+
+        auto result = vm.run( file.program( e ), e.size, e.max_depth );
+        if ( counters )
+            counters->evaluated( result.type_b );
+        out.result( result );
     }
 
-    Tokenizer my_parser; // Instancia um parser.
-    // Tentar analisar cada expressão da lista.
-    for( const auto & expr : expressions )
+    return finish_output( out );
+}
+
+/**
+ * @brief      Lê um número sem sinal do trecho [begin, end)
+ *
+ * @param[in]  begin  Início do trecho
+ * @param[in]  end    Fim do trecho (exclusivo)
+ * @param[out] value  O número (só alterado se o trecho for válido)
+ *
+ * @return     False se o trecho não for um número sem sinal que cabe em
+ *             value (vazio, com sinal, com outros caracteres ou grande demais)
+ */
+template < typename Unsigned >
+static bool parse_number( const char * begin, const char * end, Unsigned & value )
+{
+    Unsigned v = 0;
+    auto r = std::from_chars( begin, end, v );
+    if ( r.ec != std::errc() or r.ptr != end )
+        return false;
+
+    value = v;
+    return true;
+}
+
+/**
+ * @brief      Lê o número sem sinal de uma opção
+ *
+ * @param[in]  text   O argumento
+ * @param[out] value  O número (só alterado se o argumento for válido)
+ *
+ * @return     False se o argumento não for um número sem sinal que cabe em value
+ */
+template < typename Unsigned >
+static bool parse_number( const char * text, Unsigned & value )
+{  return parse_number( text, text + std::strlen( text ), value ); }
+
+/**
+ * @brief      Modo incremental: a primeira linha é a expressão e cada linha
+ *             seguinte é uma edição "POS LEN TEXTO" (substitui LEN bytes a
+ *             partir da posição POS, contada de 0, pelo resto da linha após
+ *             um espaço). O resultado é escrito após a carga e após cada
+ *             edição, igual ao do modo sequencial para o texto atual.
+ *
+ * @param[in]  options  Opções de avaliação (formato e estatísticas)
+ *
+ * @return     Execução terminada
+ */
+int run_incremental( const EvalOptions & options )
+{
+    IncrementalEvaluator inc;
+    OutputWriter out( options.output, STDOUT_FILENO );
+    stats::Counters * counters = options.stats ? options.stats->add() : nullptr;
+
+    auto report = [&]( const Tokenizer::Result & result )
     {
-        // Fazer o parsing desta expressão.
-        auto result = my_parser.parse( expr );
-        // Se houver erro, imprimir a mensagem adequada.
+        if ( counters )
+            counters->parsed( result.type, 0 );
         if ( result.type != Tokenizer::Result::OK )
-            print_msg( result);
-        else{
-        
-            // Recuperar a lista de tokens.
-            auto lista = my_parser.get_tokens();
+        {
+            out.parse_error( result );
+            return;
+        }
+        if ( counters )
+            counters->evaluated( inc.value().type_b );
+        out.result( inc.value() );
+    };
 
-            //Avaliar expressão
-            Bares bares;
-            auto result_ = bares.evaluate( lista );
+    std::string aux;
+    if ( not std::getline( std::cin, aux ) )
+        return EXIT_SUCCESS;
+    report( inc.load( aux ) );
 
-            //Imprimir mensagem de erro
-            if ( result_.type_b != Bares::Result::OK )
-                print_msg_bares( result_ );
-            else
-                std::cout << result_.value_b << std::endl;
+    for ( std::size_t line = 2; std::getline( std::cin, aux ); ++line )
+    {
+        //"POS LEN[ TEXTO]": POS e LEN só com dígitos, separados por um espaço
+        const char * line_end = aux.c_str() + aux.size();
+        const char * pos_end = std::find( aux.c_str(), line_end, ' ' );
+        const char * end = pos_end == line_end ? line_end : std::find( pos_end + 1, line_end, ' ' );
+        std::size_t pos = 0, len = 0;
+        if ( pos_end == line_end or not parse_number( aux.c_str(), pos_end, pos )
+             or not parse_number( pos_end + 1, end, len ) )
+        {
+            out.flush();
+            std::cerr << "Edição mal formada na linha " << line << "\n";
+            continue;
         }
 
+        std::string_view text( end, aux.size() - static_cast< std::size_t >( end - aux.c_str() ) );
+        if ( not text.empty() )
+            text.remove_prefix( 1 );
+        report( inc.edit( pos, len, text ) );
     }
 
+    return finish_output( out );
+}
+
+/**
+ * @brief      Modo árvore: cada linha é uma expressão muito grande, lida
+ *             (ParallelTokenizer) e avaliada por redução em árvore
+ *             (TreeEvaluator) em paralelo. O resultado é o mesmo do modo
+ *             sequencial.
+ *
+ * @param[in]  n_threads  Número de threads trabalhadoras (0: uma por núcleo)
+ * @param[in]  options    Opções de avaliação (formato e estatísticas)
+ *
+ * @return     Execução terminada
+ */
+int run_tree( std::size_t n_threads, const EvalOptions & options )
+{
+    if ( n_threads == 0 )
+        n_threads = std::thread::hardware_concurrency();
+
+    WorkStealingPool pool( n_threads );
+    TreeEvaluator tree( pool );
+    ParallelTokenizer parser( pool );
+    OutputWriter out( options.output, STDOUT_FILENO );
+    stats::Counters * counters = options.stats ? options.stats->add() : nullptr;
+
+    std::string aux;
+    while ( std::getline( std::cin, aux ) )
+    {
+        auto result = parser.parse( aux );
+        if ( counters )
+            counters->parsed( result.type, parser.get_tokens().size() );
+        if ( result.type != Tokenizer::Result::OK )
+        {
+            out.parse_error( result );
+            continue;
+        }
+
+        auto value = tree.evaluate( parser.get_tokens() );
+        if ( counters )
+            counters->evaluated( value.type_b );
+        out.result( value );
+    }
+
+    return finish_output( out );
+}
+
+/**
+ * @brief      Separa um campo de uma linha de valores (separados por espaço,
+ *             tab ou vírgula)
+ *
+ * @param[in]  line  A linha
+ * @param      pos   Posição atual; avança até depois do campo
+ *
+ * @return     O campo (vazio no fim da linha)
+ */
+static std::string_view next_field( std::string_view line, std::size_t & pos )
+{
+    auto sep = []( char c ){ return c == ' ' or c == '\t' or c == ','; };
+    while ( pos < line.size() and sep( line[ pos ] ) )
+        ++pos;
+    std::size_t begin = pos;
+    while ( pos < line.size() and not sep( line[ pos ] ) )
+        ++pos;
+    return line.substr( begin, pos - begin );
+}
+
+/**
+ * @brief      Modo fórmula: a expressão (com variáveis) é compilada uma vez;
+ *             a entrada tem um cabeçalho com os nomes das colunas e uma linha
+ *             de valores por avaliação. Escreve um resultado por linha.
+ *
+ * @param[in]  expr     A fórmula
+ * @param[in]  options  Opções de avaliação (formato e estatísticas)
+ *
+ * @return     Execução terminada
+ */
+int run_formula( const std::string & expr, const EvalOptions & options )
+{
+    Formula formula;
+    OutputWriter out( options.output, STDOUT_FILENO );
+    stats::Counters * counters = options.stats ? options.stats->add() : nullptr;
+
+    auto compiled = formula.compile( expr );
+    if ( compiled.type != Tokenizer::Result::OK )
+    {
+        out.parse_error( compiled );
+        return EXIT_FAILURE;
+    }
+
+    //Coluna da entrada de cada variável da fórmula
+    std::string aux;
+    std::getline( std::cin, aux );
+    std::vector< std::size_t > field_of( formula.variables().size(), Formula::NONE );
+    std::size_t pos = 0, n_fields = 0;
+    for ( auto name = next_field( aux, pos ); not name.empty(); name = next_field( aux, pos ), ++n_fields )
+    {
+        std::size_t k = formula.slot( name );
+        if ( k != Formula::NONE and field_of[k] == Formula::NONE )
+            field_of[k] = n_fields;
+    }
+    for ( std::size_t k = 0; k < field_of.size(); ++k )
+        if ( field_of[k] == Formula::NONE )
+        {
+            std::cerr << "Variável \"" << formula.variables()[k] << "\" não está no cabeçalho\n";
+            return EXIT_FAILURE;
+        }
+
+    //Valores em colunas; as linhas com erro de leitura ficam com 0 e o erro guardado
+    std::vector< std::vector< Formula::value_type > > columns( field_of.size() );
+    std::vector< const Formula::value_type * > column_ptrs( columns.size() );
+    std::vector< Tokenizer::Result > bad; // Erro de leitura de cada linha (OK se nenhum).
+    std::vector< Formula::value_type > values;
+    std::vector< std::uint8_t > codes;
+    std::vector< std::string_view > fields;
+    bool more = true;
+
+    while ( more )
+    {
+        for ( auto & c : columns )
+            c.clear();
+        bad.clear();
+
+        while ( bad.size() < LINES_PER_BATCH and ( more = bool( std::getline( std::cin, aux ) ) ) )
+        {
+            fields.clear();
+            pos = 0;
+            for ( auto f = next_field( aux, pos ); not f.empty(); f = next_field( aux, pos ) )
+                fields.push_back( f );
+
+            Tokenizer::Result error;
+            for ( std::size_t k = 0; k < columns.size(); ++k )
+            {
+                long v = 0;
+                if ( field_of[k] >= fields.size() )
+                {
+                    if ( error.type == Tokenizer::Result::OK )
+                        error = Tokenizer::Result( Tokenizer::Result::UNEXPECTED_END_OF_EXPRESSION, aux.size() );
+                }
+                else
+                {
+                    std::string_view f = fields[ field_of[k] ];
+                    const std::size_t col = static_cast< std::size_t >( f.data() - aux.data() ) + 1;
+                    auto r = std::from_chars( f.data(), f.data() + f.size(), v );
+                    if ( error.type == Tokenizer::Result::OK )
+                    {
+                        if ( r.ec == std::errc::invalid_argument or r.ptr != f.data() + f.size() )
+                            error = Tokenizer::Result( Tokenizer::Result::ILL_FORMED_INTEGER, col );
+                        else if ( r.ec == std::errc::result_out_of_range
+                                  or v < std::numeric_limits< Formula::value_type >::min()
+                                  or v > std::numeric_limits< Formula::value_type >::max() )
+                            error = Tokenizer::Result( Tokenizer::Result::INTEGER_OUT_OF_RANGE, col );
+                    }
+                    if ( error.type != Tokenizer::Result::OK )
+                        v = 0;
+                }
+                columns[k].push_back( static_cast< Formula::value_type >( v ) );
+            }
+            bad.push_back( error );
+        }
+
+        for ( std::size_t k = 0; k < columns.size(); ++k )
+            column_ptrs[k] = columns[k].data();
+        formula.evaluate( column_ptrs, bad.size(), values, codes );
+
+        for ( std::size_t i = 0; i < bad.size(); ++i )
+        {
+            if ( bad[i].type != Tokenizer::Result::OK )
+            {
+                out.parse_error( bad[i] );
+                continue;
+            }
+
+            Bares::Result r( values[i], static_cast< Bares::Result::code_t >( codes[i] ) );
+            if ( counters )
+                counters->evaluated( r.type_b );
+            out.result( r );
+        }
+    }
+
+    return finish_output( out );
+}
+
+//<! Servidor em execução (para o tratador de sinais).
+static Server * g_server = nullptr;
+
+/**
+ * @brief      Tratador de SIGINT/SIGTERM: encerra o servidor
+ */
+extern "C" void stop_server( int )
+{
+    if ( g_server )
+        g_server->stop();
+}
+
+/**
+ * @brief      Modo servidor: atende clientes em um socket Unix até receber
+ *             SIGINT ou SIGTERM
+ *
+ * @param[in]  path       Caminho do socket
+ * @param[in]  n_threads  Número de threads trabalhadoras
+ * @param[in]  options    Opções de avaliação
+ *
+ * @return     Execução terminada
+ */
+int run_server( const std::string & path, std::size_t n_threads, const EvalOptions & options )
+{
+    Server server( path, n_threads, options );
+
+    g_server = &server;
+    struct sigaction sa;
+    std::memset( &sa, 0, sizeof( sa ) );
+    sa.sa_handler = stop_server;
+    ::sigaction( SIGINT, &sa, nullptr );
+    ::sigaction( SIGTERM, &sa, nullptr );
+
+    server.run();
+
+    sa.sa_handler = SIG_DFL;
+    ::sigaction( SIGINT, &sa, nullptr );
+    ::sigaction( SIGTERM, &sa, nullptr );
+    g_server = nullptr;
+
     return EXIT_SUCCESS;
 }
+
+/**
+ * @brief      Imprime as opções aceitas pelo programa
+ *
+ * @param[in]  prog  Nome do executável
+ */
+void print_usage( const char * prog )
+{
+    std::cerr << "Uso: " << prog << " [opções] < entrada\n"
+              << "  --threads N      avalia em lote com N threads\n"
+              << "  --stream         avalia em fluxo, com memória limitada\n"
+              << "  --mmap ARQUIVO   lê ARQUIVO mapeado em memória\n"
+              << "  --fused          avalia durante o parsing, em uma única passada\n"
+              << "  --batch          agrupa as expressões pelo formato e avalia cada grupo com SIMD\n"
+              << "  --format FMT     formato da saída: text (padrão), jsonl ou binary\n"
+              << "  --jit            compila para código nativo os formatos de expressão frequentes\n"
+              << "  --compile ARQUIVO       grava a entrada já compilada em ARQUIVO\n"
+              << "  --run-compiled ARQUIVO  avalia um ARQUIVO gravado com --compile\n"
+              << "  --formula EXPR   avalia EXPR (com variáveis) para cada linha de valores da entrada\n"
+              << "  --tree           avalia cada linha (uma expressão muito grande) em paralelo (com --threads N)\n"
+              << "  --incremental    lê uma expressão e depois edições \"POS LEN TEXTO\", uma por linha\n"
+              << "  --serve SOCKET   atende clientes em um socket Unix (com --threads N)\n"
+              << "  --connect SOCKET envia a entrada a um servidor e escreve as respostas\n"
+              << "  --cache BYTES    guarda resultados repetidos em até BYTES de memória\n"
+              << "  --stats=json|prom     imprime estatísticas ao final (em stderr)\n"
+              << "  --stats-file ARQUIVO  grava as estatísticas em ARQUIVO\n"
+              << "  --stats-interval N    regrava as estatísticas a cada N segundos\n";
+}
+
+/**
+ * @brief      Programa principal
+ *
+ * @param[in]  argc  Número de argumentos
+ * @param      argv  Argumentos (ver print_usage)
+ *
+ * @return     Execução terminada
+ */
+int main( int argc, char * argv[] )
+{
+    std::size_t n_threads = 0;
+    bool stream = false;
+    bool batch = false;
+    bool incremental = false;
+    bool tree = false;
+    std::string mmap_path;
+    std::string serve_path;
+    std::string compile_path;
+    std::string compiled_path;
+    std::string connect_path;
+    std::string formula;
+    bool with_formula = false;
+    EvalOptions options;
+    bool with_stats = false;
+    stats::format_t stats_format = stats::format_t::JSON;
+    std::string stats_path;
+    unsigned stats_interval = 0;
+
+    for ( int i = 1; i < argc; ++i )
+    {
+        if ( std::strcmp( argv[i], "--threads" ) == 0 and i + 1 < argc
+             and parse_number( argv[i + 1], n_threads ) )
+        {
+            ++i;
+        }
+        else if ( std::strcmp( argv[i], "--stream" ) == 0 )
+        {
+            stream = true;
+        }
+        else if ( std::strcmp( argv[i], "--mmap" ) == 0 and i + 1 < argc )
+        {
+            mmap_path = argv[++i];
+        }
+        else if ( std::strcmp( argv[i], "--serve" ) == 0 and i + 1 < argc )
+        {
+            serve_path = argv[++i];
+        }
+        else if ( std::strcmp( argv[i], "--connect" ) == 0 and i + 1 < argc )
+        {
+            connect_path = argv[++i];
+        }
+        else if ( std::strcmp( argv[i], "--compile" ) == 0 and i + 1 < argc )
+        {
+            compile_path = argv[++i];
+        }
+        else if ( std::strcmp( argv[i], "--run-compiled" ) == 0 and i + 1 < argc )
+        {
+            compiled_path = argv[++i];
+        }
+        else if ( std::strcmp( argv[i], "--formula" ) == 0 and i + 1 < argc )
+        {
+            formula = argv[++i];
+            with_formula = true;
+        }
+        else if ( std::strcmp( argv[i], "--incremental" ) == 0 )
+        {
+            incremental = true;
+        }
+        else if ( std::strcmp( argv[i], "--tree" ) == 0 )
+        {
+            tree = true;
+        }
+        else if ( std::strcmp( argv[i], "--batch" ) == 0 )
+        {
+            batch = true;
+        }
+        else if ( std::strcmp( argv[i], "--fused" ) == 0 )
+        {
+            options.fused = true;
+        }
+        else if ( std::strcmp( argv[i], "--format" ) == 0 and i + 1 < argc
+                  and OutputWriter::parse_format( argv[i + 1], options.output ) )
+        {
+            ++i;
+        }
+        else if ( std::strcmp( argv[i], "--jit" ) == 0 )
+        {
+            options.jit = true;
+        }
+        else if ( std::strcmp( argv[i], "--cache" ) == 0 and i + 1 < argc
+                  and parse_number( argv[i + 1], options.cache_bytes ) )
+        {
+            ++i;
+        }
+        else if ( std::strcmp( argv[i], "--stats=json" ) == 0 or std::strcmp( argv[i], "--stats=prom" ) == 0 )
+        {
+            with_stats = true;
+            stats_format = argv[i][8] == 'j' ? stats::format_t::JSON : stats::format_t::PROM;
+        }
+        else if ( std::strcmp( argv[i], "--stats-file" ) == 0 and i + 1 < argc )
+        {
+            stats_path = argv[++i];
+        }
+        else if ( std::strcmp( argv[i], "--stats-interval" ) == 0 and i + 1 < argc
+                  and parse_number( argv[i + 1], stats_interval ) )
+        {
+            ++i;
+        }
+        else
+        {
+            print_usage( argv[0] );
+            return EXIT_FAILURE;
+        }
+    }
+
+    //Estatísticas: relatório periódico (opcional) e relatório final
+    stats::Registry registry;
+    std::unique_ptr< stats::Reporter > reporter;
+    if ( with_stats )
+    {
+        options.stats = &registry;
+        if ( stats_interval > 0 )
+            reporter.reset( new stats::Reporter( registry, stats_format, stats_path, stats_interval ) );
+    }
+
+    int status = EXIT_SUCCESS;
+    if ( not connect_path.empty() )
+    {
+        try {
+            status = run_client( connect_path, STDIN_FILENO, STDOUT_FILENO ) ? EXIT_SUCCESS : EXIT_FAILURE;
+        } catch ( const std::runtime_error & e ) {
+            std::cerr << e.what() << "\n";
+            status = EXIT_FAILURE;
+        }
+    }
+    else if ( not serve_path.empty() )
+    {
+        try {
+            status = run_server( serve_path, n_threads, options );
+        } catch ( const std::runtime_error & e ) {
+            std::cerr << e.what() << "\n";
+            status = EXIT_FAILURE;
+        }
+    }
+    else if ( not compile_path.empty() or not compiled_path.empty() )
+    {
+        try {
+            status = compile_path.empty() ? run_compiled( compiled_path, options )
+                                          : run_compile( compile_path, options );
+        } catch ( const std::runtime_error & e ) {
+            std::cerr << e.what() << "\n";
+            status = EXIT_FAILURE;
+        }
+    }
+    else if ( not mmap_path.empty() )
+    {
+        try {
+            status = run_mapped( mmap_path, options );
+        } catch ( const std::runtime_error & e ) {
+            std::cerr << e.what() << "\n";
+            status = EXIT_FAILURE;
+        }
+    }
+    else if ( with_formula )
+        status = run_formula( formula, options );
+    else if ( incremental )
+        status = run_incremental( options );
+    else if ( tree )
+        status = run_tree( n_threads, options );
+    else if ( stream )
+        status = run_stream( options );
+    else if ( batch )
+        status = run_batch( options );
+    else if ( n_threads > 0 )
+        status = run_threaded( n_threads, options );
+    else
+        status = run_sequential( options );
+
+    if ( with_stats )
+    {
+        reporter.reset();
+        std::cout.flush();
+        stats::dump( registry, stats_format, stats_path );
+    }
+
+    return status;
+}
@@ -0,0 +1,134 @@
+/**
+ * @file evaluator.cpp
+ * @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+ * @date 18 Outubro 2026
+ * @brief Arquivo com a implementação da classe Evaluator e das mensagens
+ *        de erro.
+ */
+
+#include "evaluator.h"
+
+//<! Imprime menssagens de erro do Bares
+void print_msg_bares( std::ostream & os, const Bares::Result & result )
+{
+    OutputWriter out;
+    out.result( result );
+    os << out.view();
+}
+
+//<! Imprime menssagens de erro do Tokenizer
+void print_msg( std::ostream & os, const Tokenizer::Result & result )
+{
+    OutputWriter out;
+    out.parse_error( result );
+    os << out.view();
+}
+
+//<! Cria o avaliador
+Evaluator::Evaluator( const EvalOptions & options_ )
+    : options( options_ )
+    , cache( options_.cache_bytes )
+    , counters( options_.stats ? options_.stats->add() : nullptr )
+{ /* empty */ }
+
+//<! Avalia uma expressão e escreve o resultado
+void Evaluator::eval( std::string_view expr_, std::ostream & os_ )
+{
+    eval( expr_, text );
+    os_ << text.view();
+    text.clear();
+}
+
+//<! Avalia uma expressão e escreve o resultado no OutputWriter
+void Evaluator::eval( std::string_view expr_, OutputWriter & out_ )
+{
+    //O relógio só é consultado com as estatísticas ligadas
+    auto t = counters ? stats::clock_type::now() : stats::clock_type::time_point();
+
+    if ( options.fused )
+    {
+        //Parsing e cálculo em uma única passada
+        Bares::Result value;
+        auto result = fused.run( expr_, value );
+        if ( counters )
+        {
+            t = counters->lap( stats::FUSED, t );
+            counters->parsed( result.type, 0 );
+            if ( result.type == Tokenizer::Result::OK )
+                counters->evaluated( value.type_b );
+        }
+
+        if ( result.type != Tokenizer::Result::OK )
+            out_.parse_error( result );
+        else
+            out_.result( value );
+
+        if ( counters )
+            counters->lap( stats::OUTPUT, t );
+        return;
+    }
+
+    // Fazer o parsing desta expressão.
+    auto result = parser.parse( expr_ );
+    if ( counters )
+    {
+        t = counters->lap( stats::TOKENIZE, t );
+        counters->parsed( result.type, parser.get_tokens().size() );
+    }
+
+    // Se houver erro, imprimir a mensagem adequada.
+    if ( result.type != Tokenizer::Result::OK )
+    {
+        out_.parse_error( result );
+        if ( counters )
+            counters->lap( stats::OUTPUT, t );
+        return;
+    }
+
+    eval_tokens( parser.get_tokens(), out_ );
+}
+
+//<! Avalia uma lista de Tokens já validada
+void Evaluator::eval_tokens( const std::vector< Token > & tokens_, OutputWriter & out_ )
+{
+    auto t = counters ? stats::clock_type::now() : stats::clock_type::time_point();
+
+    //Um acerto no cache dispensa a conversão e o cálculo
+    if ( cache.enabled() )
+    {
+        ResultCache::make_key( tokens_, key );
+        if ( const Bares::Result * hit = cache.find( key ) )
+        {
+            if ( counters )
+                counters->cached( hit->type_b );
+            out_.result( *hit );
+            if ( counters )
+                counters->lap( stats::OUTPUT, t );
+            return;
+        }
+    }
+
+    //Compilar e avaliar expressão
+    bares.infix_to_postfix( tokens_ );
+    if ( counters )
+        t = counters->lap( stats::POSTFIX, t );
+
+    //O código nativo só existe para formatos já vistos várias vezes
+    Bares::Result result;
+    if ( not options.jit or not jit_cache.run( bares.postfix(), result ) )
+    {
+        bc::compile( bares.postfix(), program );
+        result = vm.run( program );
+    }
+    if ( counters )
+    {
+        t = counters->lap( stats::EVALUATE, t );
+        counters->evaluated( result.type_b );
+    }
+
+    if ( cache.enabled() )
+        cache.insert( key, result );
+    out_.result( result );
+    if ( counters )
+        counters->lap( stats::OUTPUT, t );
+}
@@ -0,0 +1,144 @@
+/**
+ * @file formula.cpp
+ * @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+ * @date 18 Outubro 2026
+ * @brief Arquivo com a implementação da classe Formula.
+ */
+
+#include "formula.h"
+
+#include <algorithm> // std::min, std::fill, std::copy
+#include <cstring>   // std::memcpy
+
+#include "batch_eval.h" // BatchEvaluator::apply
+
+namespace {
+
+    //<! Linhas avaliadas juntas; cada linha da pilha ocupa TILE valores.
+    constexpr std::size_t TILE = 1024;
+
+    static_assert( TILE % BatchEvaluator::LANES == 0, "TILE deve ser múltiplo de LANES" );
+
+    //<! Lê o operando em linha de PUSH ou LOAD
+    template < typename T >
+    T inline_operand( const std::uint8_t * pc_ )
+    {
+        T v;
+        std::memcpy( &v, pc_, sizeof( v ) );
+        return v;
+    }
+}
+
+//<! Compila a expressão
+Tokenizer::Result Formula::compile( std::string_view expr_ )
+{
+    prog.clear();
+    names.clear();
+
+    parser.allow_variables( true );
+    auto result = parser.parse( expr_ );
+    if ( result.type != Tokenizer::Result::OK )
+        return result;
+
+    names = parser.variables();
+    bares.infix_to_postfix( parser.get_tokens() );
+    bc::compile( bares.postfix(), prog );
+
+    //Cada constante vira uma linha inteira, montada uma única vez
+    constants.clear();
+    for ( const Token & t : bares.postfix() )
+        if ( t.type == Token::token_t::OPERAND )
+            constants.insert( constants.end(), TILE, t.value );
+
+    return result;
+}
+
+//<! Posição de uma variável em variables()
+std::size_t Formula::slot( std::string_view name_ ) const
+{
+    for ( std::size_t i = 0; i < names.size(); ++i )
+        if ( names[i] == name_ )
+            return i;
+    return NONE;
+}
+
+//<! Avalia a fórmula sobre rows_ linhas de valores
+void Formula::evaluate( const std::vector< const value_type * > & columns_, std::size_t rows_,
+                        std::vector< value_type > & values_, std::vector< std::uint8_t > & codes_ )
+{
+    assert( not prog.code.empty() and columns_.size() >= names.size() );
+
+    values_.resize( rows_ );
+    codes_.resize( rows_ );
+    rows.resize( prog.max_depth * TILE );
+    stack.resize( prog.max_depth );
+    zeros.assign( TILE, 0 );
+    codes.resize( TILE );
+
+    const std::uint8_t * begin = prog.code.data();
+    const std::uint8_t * end = begin + prog.code.size();
+
+    for ( std::size_t first = 0; first < rows_; first += TILE )
+    {
+        const std::size_t n = std::min( TILE, rows_ - first );
+        const std::size_t lanes = ( n + BatchEvaluator::LANES - 1 ) / BatchEvaluator::LANES * BatchEvaluator::LANES;
+        std::fill( codes.begin(), codes.begin() + lanes, std::int16_t( Bares::Result::OK ) );
+
+        const std::int16_t * constant = constants.data();
+        std::size_t sp = 0;
+        for ( const std::uint8_t * pc = begin; pc != end; )
+        {
+            auto op = static_cast< bc::opcode_t >( *pc++ );
+            switch ( op )
+            {
+                case bc::opcode_t::PUSH:
+                    pc += sizeof( std::int16_t );
+                    stack[ sp++ ] = constant;
+                    constant += TILE;
+                    break;
+
+                case bc::opcode_t::LOAD:
+                {
+                    const value_type * column = columns_[ inline_operand< std::uint16_t >( pc ) ] + first;
+                    pc += sizeof( std::uint16_t );
+
+                    //O último bloco é copiado para completar o registrador (a sobra fica com 0)
+                    if ( lanes != n )
+                    {
+                        std::int16_t * row = &rows[ sp * TILE ];
+                        std::copy( column, column + n, row );
+                        std::fill( row + n, row + lanes, std::int16_t( 0 ) );
+                        column = row;
+                    }
+                    stack[ sp++ ] = column;
+                    break;
+                }
+
+                case bc::opcode_t::NEG:
+                {
+                    std::int16_t * r = &rows[ ( sp - 1 ) * TILE ];
+                    BatchEvaluator::apply( bc::opcode_t::SUB, zeros.data(), stack[ sp - 1 ], r, codes.data(), lanes );
+                    stack[ sp - 1 ] = r;
+                    break;
+                }
+
+                default:
+                {
+                    //Operação binária: o resultado fica na linha da posição que ele ocupa na pilha
+                    --sp;
+                    std::int16_t * r = &rows[ ( sp - 1 ) * TILE ];
+                    BatchEvaluator::apply( op, stack[ sp - 1 ], stack[ sp ], r, codes.data(), lanes );
+                    stack[ sp - 1 ] = r;
+                    break;
+                }
+            }
+        }
+
+        const std::int16_t * values = stack[0];
+        for ( std::size_t i = 0; i < n; ++i )
+        {
+            codes_[ first + i ] = static_cast< std::uint8_t >( codes[i] );
+            values_[ first + i ] = codes[i] == Bares::Result::OK ? values[i] : 0;
+        }
+    }
+}
@@ -0,0 +1,238 @@
+/**
+ * @file fused_evaluator.cpp
+ * @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+ * @date 18 Outubro 2026
+ * @brief Arquivo com a implementação do avaliador de passada única.
+ */
+
+#include "fused_evaluator.h"
+
+namespace {
+    //<! Converte o caractere para o operador correspondente
+    Token::operator_t operator_of( char c_ )
+    {
+        switch ( c_ )
+        {
+            case '+': return Token::operator_t::PLUS;
+            case '-': return Token::operator_t::MINUS;
+            case '*': return Token::operator_t::ASTERISK;
+            case '/': return Token::operator_t::SLASH;
+            case '%': return Token::operator_t::MOD;
+            case '^': return Token::operator_t::CARRET;
+            default : return Token::operator_t::NONE;
+        }
+    }
+
+    //<! Precedência do operador, a mesma de Bares::get_precedence
+    int precedence( Token::operator_t op_ )
+    {
+        switch ( op_ )
+        {
+            case Token::operator_t::CARRET   : return 3;
+            case Token::operator_t::ASTERISK :
+            case Token::operator_t::SLASH    :
+            case Token::operator_t::MOD      : return 2;
+            default                          : return 1;
+        }
+    }
+
+    //<! "^" é o único operador associado pela direita
+    bool is_right_association( Token::operator_t op_ )
+    {
+        return op_ == Token::operator_t::CARRET;
+    }
+}
+
+//<! Faz o parsing e avalia a expressão
+Tokenizer::Result FusedEvaluator::run( std::string_view e_, Bares::Result & value_ )
+{
+    expr = e_;
+    pos = 0;
+    error = Bares::Result::OK;
+    masks.classify( expr );
+
+    skip_ws();
+    if ( end_input() )
+        return Result( Result::UNEXPECTED_END_OF_EXPRESSION, pos );
+
+    value_type value = 0;
+    auto result = expression( value );
+
+    if ( result.type == Result::OK )
+    {
+        //Tenta detectar símbolo estranho
+        skip_ws();
+        if ( not end_input() )
+            return Result( Result::EXTRANEOUS_SYMBOL, pos + 1 );
+
+        value_ = Bares::Result( error == Bares::Result::OK ? value : 0, error );
+    }
+
+    return result;
+}
+
+//<! Ignora qualquer espaço/Tab
+void FusedEvaluator::skip_ws( void )
+{
+    pos = masks.next_non_ws( pos );
+}
+
+//<! Verifica se chegamos ao final da expressão
+bool FusedEvaluator::end_input( void ) const
+{
+    return pos == expr.size();
+}
+
+//<! Aplica um operador, a menos que já tenha havido erro
+void FusedEvaluator::apply( Token::operator_t op_, value_type & lhs_, value_type rhs_ )
+{
+    if ( error != Bares::Result::OK )
+        return;
+
+    auto r = bares.execute( lhs_, rhs_, Token( Token::token_t::OPERATOR, op_ ) );
+    if ( r.type_b != Bares::Result::OK )
+        error = r.type_b;
+    else
+        lhs_ = r.value_b;
+}
+
+//<! <expr> := <term>,{ ("+"|"-"|"*"|"/"|"%"|"^"),<term> }
+Tokenizer::Result FusedEvaluator::expression( value_type & value_ )
+{
+    skip_ws();
+    auto result = term( value_ );
+    if ( result.type != Result::OK )
+        return result;
+
+    return climb( value_, 0 );
+}
+
+//<! Precedence climbing sobre os operadores seguintes
+Tokenizer::Result FusedEvaluator::climb( value_type & lhs_, int min_prec_ )
+{
+    while ( true )
+    {
+        skip_ws();
+        if ( not masks.is_operator( pos ) )
+            return Result( Result::OK );
+
+        auto op = operator_of( expr[pos] );
+        int prec = precedence( op );
+        if ( prec < min_prec_ )
+            return Result( Result::OK );
+        ++pos;
+
+        value_type rhs = 0;
+        auto result = term( rhs );
+        if ( result.type != Result::OK )
+        {
+            if ( result.type != Result::INTEGER_OUT_OF_RANGE and end_input() )
+                result.type = Result::MISSING_TERM;
+            return result;
+        }
+
+        //Operadores seguintes que ligam mais forte ficam com o operando direito
+        while ( true )
+        {
+            skip_ws();
+            if ( not masks.is_operator( pos ) )
+                break;
+
+            auto next = operator_of( expr[pos] );
+            int next_prec = precedence( next );
+            if ( next_prec > prec )
+                result = climb( rhs, prec + 1 );
+            else if ( next_prec == prec and is_right_association( next ) )
+                result = climb( rhs, prec );
+            else
+                break;
+
+            if ( result.type != Result::OK )
+                return result;
+        }
+
+        apply( op, lhs_, rhs );
+    }
+}
+
+//<! <term> := "(",<expr>,")" | <integer>
+Tokenizer::Result FusedEvaluator::term( value_type & value_ )
+{
+    skip_ws();
+    std::size_t begin = pos;
+
+    //Pode vir um "("
+    if ( not end_input() and expr[pos] == '(' )
+    {
+        ++pos;
+        auto result = expression( value_ );
+
+        //Se não houver erro na expressão, deve vir ")"
+        if ( result.type == Result::OK )
+        {
+            skip_ws();
+            if ( end_input() or expr[pos] != ')' )
+                return Result( Result::MISSING_CLOSING_PARENTHESIS, pos );
+            ++pos;
+        }
+        return result;
+    }
+
+    Tokenizer::input_int_type value = 0;
+    bool negative = false;
+    auto result = integer( value, negative );
+    if ( result.type == Result::OK )
+    {
+        //Testa se o valor está no limite de required_int_type
+        Tokenizer::required_int_type v;
+        if ( not arith::from_magnitude( value, negative, v ) )
+            value_ = v;
+        else
+            result = Result( Result::INTEGER_OUT_OF_RANGE, begin + 1 );
+    }
+
+    return result;
+}
+
+//<! <integer> := 0 | ["-"],<natural_number>
+Tokenizer::Result FusedEvaluator::integer( Tokenizer::input_int_type & value_, bool & negative_ )
+{
+    negative_ = false;
+    if ( not end_input() and expr[pos] == '0' )
+    {
+        ++pos;
+        value_ = 0;
+        return Result( Result::OK );
+    }
+
+    //Pode vir vários "-", com espaços entre eles
+    auto cont(0);
+    while ( true )
+    {
+        skip_ws();
+        if ( end_input() or expr[pos] != '-' )
+            break;
+        ++pos;
+        ++cont;
+    }
+
+    //<natural_number> := <digit_excl_zero>,{<digit>}
+    if ( end_input() or expr[pos] < '1' or expr[pos] > '9' )
+        return Result( Result::ILL_FORMED_INTEGER, pos + 1 );
+
+    //Ao estourar, o módulo fica saturado (sempre fora da faixa)
+    std::size_t end = masks.next_non_digit( pos + 1 );
+    value_ = 0;
+    for ( ; pos != end; ++pos )
+        if ( arith::mul( value_, Tokenizer::input_int_type( 10 ), value_ )
+             or arith::add( value_, Tokenizer::input_int_type( expr[pos] - '0' ), value_ ) )
+        {
+            value_ = std::numeric_limits< Tokenizer::input_int_type >::max();
+            pos = end;
+            break;
+        }
+
+    negative_ = cont % 2 == 1;
+
+    return Result( Result::OK );
+}
@@ -0,0 +1,315 @@
+/**
+ * @file incremental.cpp
+ * @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+ * @date 18 Outubro 2026
+ * @brief Arquivo com a implementação da classe IncrementalEvaluator.
+ */
+
+#include "incremental.h"
+
+#include <algorithm> // std::min
+
+namespace {
+
+    //<! Precedência dos operadores, a mesma de Bares::get_precedence ("(" fica no fundo)
+    int precedence( const Token & t_ )
+    {
+        if ( t_.type == Token::token_t::OPENING_SCOPE )
+            return 0;
+
+        switch ( t_.op )
+        {
+            case Token::operator_t::CARRET   : return 3;
+            case Token::operator_t::ASTERISK :
+            case Token::operator_t::SLASH    :
+            case Token::operator_t::MOD      : return 2;
+            default                          : return 1;
+        }
+    }
+
+    //<! O operador do topo sai antes do novo? (Bares::has_higher_precedence)
+    bool has_higher_precedence( const Token & top_, const Token & new_ )
+    {
+        int p1 = precedence( top_ );
+        int p2 = precedence( new_ );
+        if ( p1 == p2 and top_.op == Token::operator_t::CARRET )
+            return false; // "^" associa pela direita.
+        return p1 >= p2;
+    }
+
+    //<! Comprimento de uma constante que começa em begin_ ("-", espaços e dígitos)
+    std::size_t literal_length( std::string_view text_, std::size_t begin_ )
+    {
+        std::size_t i = begin_;
+        while ( i < text_.size() and ( text_[i] == '-' or text_[i] == ' ' or text_[i] == '\t' ) )
+            ++i;
+        while ( i < text_.size() and text_[i] >= '0' and text_[i] <= '9' )
+            ++i;
+        return i - begin_;
+    }
+}
+
+//<! Analisa e avalia a expressão inteira
+Tokenizer::Result IncrementalEvaluator::load( std::string_view expr_ )
+{
+    expr.assign( expr_.data(), expr_.size() );
+    return full_parse();
+}
+
+//<! Substitui um trecho do texto e reavalia a expressão
+Tokenizer::Result IncrementalEvaluator::edit( std::size_t pos_, std::size_t erase_, std::string_view insert_ )
+{
+    ++work.edits;
+    pos_ = std::min( pos_, expr.size() );
+    erase_ = std::min( erase_, expr.size() - pos_ );
+    const std::size_t end = pos_ + erase_;
+
+    //Desce da raiz até o menor átomo que contém [pos_, end]
+    std::uint32_t atom = NONE;
+    std::size_t atom_begin = 0;
+    if ( root != NONE )
+    {
+        std::uint32_t n = root;
+        std::size_t begin = nodes[ root ].offset;
+        while ( n != NONE )
+        {
+            if ( nodes[n].kind != Node::BINARY )
+            {
+                atom = n;
+                atom_begin = begin;
+            }
+
+            std::uint32_t next = NONE;
+            for ( std::uint32_t c : { nodes[n].left, nodes[n].right } )
+            {
+                if ( c == NONE )
+                    continue;
+                std::size_t c_begin = begin + nodes[c].offset;
+                if ( pos_ >= c_begin and end <= c_begin + nodes[c].length )
+                {
+                    next = c;
+                    begin = c_begin;
+                    break;
+                }
+            }
+            n = next;
+        }
+
+        //O átomo precisa conter a edição (a raiz pode não conter)
+        if ( atom != NONE and not ( pos_ >= atom_begin and end <= atom_begin + nodes[ atom ].length ) )
+            atom = NONE;
+    }
+
+    expr.replace( pos_, erase_, insert_.data(), insert_.size() );
+    if ( atom == NONE )
+        return full_parse();
+
+    //Só o texto do átomo é analisado de novo
+    const std::size_t old_length = nodes[ atom ].length;
+    const std::size_t new_length = old_length - erase_ + insert_.size();
+    std::string_view piece( expr.data() + atom_begin, new_length );
+    work.reparsed_bytes += new_length;
+
+    if ( parser.parse( piece ).type != Tokenizer::Result::OK )
+        return full_parse();
+
+    //O novo trecho precisa continuar sendo um único átomo, do mesmo tamanho
+    std::uint32_t sub = build( piece, atom_begin );
+    if ( nodes[ sub ].kind == Node::BINARY or nodes[ sub ].offset != atom_begin
+         or nodes[ sub ].length != new_length )
+        return full_parse();
+
+    //Troca a subárvore
+    const std::uint32_t parent = nodes[ atom ].parent;
+    nodes[ sub ].parent = parent;
+    if ( parent == NONE )
+        root = sub;
+    else
+    {
+        nodes[ sub ].offset = nodes[ atom ].offset;
+        if ( nodes[ parent ].left == atom )
+            nodes[ parent ].left = sub;
+        else
+            nodes[ parent ].right = sub;
+    }
+    release( atom );
+
+    //Ancestrais: comprimento, deslocamento do irmão à direita e valor
+    std::uint32_t child = sub;
+    for ( std::uint32_t p = parent; p != NONE; child = p, p = nodes[p].parent )
+    {
+        Node & np = nodes[p];
+        np.length = np.length + new_length - old_length;
+        if ( np.kind == Node::BINARY and np.left == child )
+            nodes[ np.right ].offset = nodes[ np.right ].offset + new_length - old_length;
+        combine( np );
+        ++work.updated_nodes;
+    }
+
+    return Tokenizer::Result( Tokenizer::Result::OK );
+}
+
+//<! Resultado do cálculo
+Bares::Result IncrementalEvaluator::value( void ) const
+{
+    return root != NONE ? nodes[ root ].result : Bares::Result();
+}
+
+//<! Faz o parsing completo e reconstrói a árvore
+Tokenizer::Result IncrementalEvaluator::full_parse( void )
+{
+    ++work.full_parses;
+    nodes.clear();
+    free_nodes.clear();
+    root = NONE;
+
+    auto result = parser.parse( expr );
+    if ( result.type == Tokenizer::Result::OK )
+        root = build( expr, 0 );
+
+    return result;
+}
+
+//<! Constrói a árvore dos Tokens do parser (shunting-yard de Bares::infix_to_postfix)
+std::uint32_t IncrementalEvaluator::build( std::string_view text_, std::size_t base_ )
+{
+    operands.clear();
+    operators.clear();
+
+    for ( const Token & t : parser.get_tokens() )
+    {
+        switch ( t.type )
+        {
+            case Token::token_t::OPERAND:
+            {
+                std::uint32_t n = make_node( Node::LITERAL );
+                nodes[n].offset = base_ + t.col - 1;
+                nodes[n].length = literal_length( text_, t.col - 1 );
+                nodes[n].result = Bares::Result( t.value );
+                operands.push_back( n );
+                break;
+            }
+
+            case Token::token_t::OPERATOR:
+                while ( not operators.empty() and has_higher_precedence( operators.back(), t ) )
+                    reduce();
+                operators.push_back( t );
+                break;
+
+            case Token::token_t::OPENING_SCOPE:
+                operators.push_back( t );
+                break;
+
+            case Token::token_t::CLOSING_SCOPE:
+            {
+                while ( operators.back().type != Token::token_t::OPENING_SCOPE )
+                    reduce();
+                const std::size_t open = base_ + operators.back().col - 1;
+                operators.pop_back();
+
+                //O grupo vai de "(" até ")", inclusive
+                std::uint32_t g = make_node( Node::GROUP );
+                std::uint32_t inner = operands.back();
+                nodes[g].offset = open;
+                nodes[g].length = base_ + t.col - open;
+                nodes[g].left = inner;
+                nodes[inner].parent = g;
+                nodes[inner].offset -= open;
+                combine( nodes[g] );
+                operands.back() = g;
+                break;
+            }
+
+            case Token::token_t::VARIABLE:
+                assert( false ); //parser não aceita variáveis (allow_variables desligado)
+                break;
+        }
+    }
+
+    while ( not operators.empty() )
+        reduce();
+
+    return operands.back();
+}
+
+//<! Junta o operador do topo com as duas últimas subárvores
+void IncrementalEvaluator::reduce( void )
+{
+    Token op = operators.back();
+    operators.pop_back();
+    std::uint32_t r = operands.back();
+    operands.pop_back();
+    std::uint32_t l = operands.back();
+
+    std::uint32_t n = make_node( Node::BINARY );
+    nodes[n].op = op.op;
+    nodes[n].left = l;
+    nodes[n].right = r;
+    nodes[n].offset = nodes[l].offset;
+    nodes[n].length = nodes[r].offset + nodes[r].length - nodes[l].offset;
+
+    //Os filhos passam a ter deslocamento relativo
+    nodes[r].offset -= nodes[n].offset;
+    nodes[l].offset = 0;
+    nodes[l].parent = n;
+    nodes[r].parent = n;
+    combine( nodes[n] );
+
+    operands.back() = n;
+}
+
+//<! Cria um nó
+std::uint32_t IncrementalEvaluator::make_node( Node::kind_t kind_ )
+{
+    std::uint32_t n;
+    if ( not free_nodes.empty() )
+    {
+        n = free_nodes.back();
+        free_nodes.pop_back();
+        nodes[n] = Node();
+    }
+    else
+    {
+        n = static_cast< std::uint32_t >( nodes.size() );
+        nodes.emplace_back();
+    }
+    nodes[n].kind = kind_;
+    return n;
+}
+
+//<! Devolve uma subárvore à lista de nós livres
+void IncrementalEvaluator::release( std::uint32_t n_ )
+{
+    operands.clear();
+    operands.push_back( n_ );
+    while ( not operands.empty() )
+    {
+        std::uint32_t n = operands.back();
+        operands.pop_back();
+        if ( nodes[n].left != NONE )
+            operands.push_back( nodes[n].left );
+        if ( nodes[n].right != NONE )
+            operands.push_back( nodes[n].right );
+        free_nodes.push_back( n );
+    }
+}
+
+//<! Recalcula o valor de um nó: vale o primeiro erro na ordem posfixa
+void IncrementalEvaluator::combine( Node & n_ )
+{
+    const Bares::Result & l = nodes[ n_.left ].result;
+    if ( n_.kind == Node::GROUP or l.type_b != Bares::Result::OK )
+    {
+        n_.result = l;
+        return;
+    }
+
+    const Bares::Result & r = nodes[ n_.right ].result;
+    if ( r.type_b != Bares::Result::OK )
+    {
+        n_.result = r;
+        return;
+    }
+
+    n_.result = bares.execute( l.value_b, r.value_b, Token( Token::token_t::OPERATOR, n_.op ) );
+}
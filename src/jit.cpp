@@ -0,0 +1,363 @@
+/**
+ * @file jit.cpp
+ * @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+ * @date 18 Outubro 2026
+ * @brief Arquivo com a implementação do compilador JIT (x86-64).
+ */
+
+#include "jit.h"
+
+#include <algorithm> // std::max, std::min
+#include <cstring>   // std::memcpy
+
+#include "bytecode.h" // bc::opcode_t, bc::opcode_of
+
+#if defined(__x86_64__) && defined(__unix__)
+#include <sys/mman.h> // mmap, mprotect, munmap
+#include <unistd.h>   // sysconf
+#define BARES_JIT 1
+#endif
+
+namespace {
+
+    //<! Formatos maiores que isto ficam com o interpretador.
+    constexpr std::size_t MAX_TOKENS = 1024;
+
+    //<! Formatos quentes no mapa; acima disso os novos ficam com o interpretador.
+    constexpr std::size_t MAX_SHAPES = 1 << 16;
+
+    //<! Contadores de formatos frios (2^COUNTER_BITS).
+    constexpr unsigned COUNTER_BITS = 12;
+
+    //<! Tamanho mínimo de cada região de código.
+    constexpr std::size_t CHUNK_SIZE = 64 * 1024;
+
+    //<! Códigos devolvidos pelas funções geradas (os de Bares::Result).
+    constexpr std::uint8_t CODE_DIV_ZERO = Bares::Result::DIVISION_BY_ZERO;
+    constexpr std::uint8_t CODE_OVERFLOW = Bares::Result::NUMERIC_OVERFLOW;
+
+    /**
+     * @brief      Gera o código de um formato.
+     *
+     *             Convenção (System V): rdi aponta para os operandos, rsi para
+     *             o resultado. O topo da pilha fica em eax e os demais valores
+     *             na pilha da máquina; r8 guarda o rsp da entrada para que as
+     *             saídas de erro descartem o que foi empilhado. Os valores são
+     *             int16 estendidos para 32 bits.
+     */
+    class Emitter
+    {
+        public:
+            explicit Emitter( std::vector< std::uint8_t > & out_ ) : out( out_ ) {}
+
+            //<! mov r8, rsp
+            void prologue( void ) { bytes( { 0x49, 0x89, 0xE0 } ); }
+
+            //<! Empilha o k-ésimo operando
+            void push_literal( std::size_t k_, bool spill_ )
+            {
+                if ( spill_ )
+                    bytes( { 0x50 } );                 // push rax
+                bytes( { 0x0F, 0xBF, 0x87 } );         // movsx eax, word [rdi + disp32]
+                imm32( static_cast< std::uint32_t >( 2 * k_ ) );
+            }
+
+            //<! eax = segundo valor da pilha, ecx = topo
+            void operands( void )
+            {
+                bytes( { 0x89, 0xC1 } );               // mov ecx, eax
+                bytes( { 0x58 } );                     // pop rax
+            }
+
+            //<! Soma, subtração e multiplicação em 16 bits, com OF indicando overflow
+            void add( void ) { bytes( { 0x66, 0x01, 0xC8 } ); overflow_check16(); }  // add ax, cx
+            void sub( void ) { bytes( { 0x66, 0x29, 0xC8 } ); overflow_check16(); }  // sub ax, cx
+            void mul( void ) { bytes( { 0x66, 0x0F, 0xAF, 0xC1 } ); overflow_check16(); } // imul ax, cx
+
+            //<! Divisão em 32 bits (não há trap: os valores são int16); o quociente precisa caber em 16
+            void div( void )
+            {
+                zero_check();
+                bytes( { 0x99, 0xF7, 0xF9 } );         // cdq; idiv ecx
+                bytes( { 0x0F, 0xBF, 0xD0 } );         // movsx edx, ax
+                bytes( { 0x39, 0xC2 } );               // cmp edx, eax
+                jump( 0x85, overflow_jumps );          // jne overflow
+            }
+
+            //<! Resto em 32 bits (sempre cabe em 16)
+            void mod( void )
+            {
+                zero_check();
+                bytes( { 0x99, 0xF7, 0xF9 } );         // cdq; idiv ecx
+                bytes( { 0x89, 0xD0 } );               // mov eax, edx
+            }
+
+            //<! Grava o resultado, devolve OK e gera as saídas de erro
+            void epilogue( void )
+            {
+                bytes( { 0x66, 0x89, 0x06 } );         // mov [rsi], ax
+                bytes( { 0x31, 0xC0, 0xC3 } );         // xor eax, eax; ret
+
+                error_exit( overflow_jumps, CODE_OVERFLOW );
+                error_exit( zero_jumps, CODE_DIV_ZERO );
+            }
+
+        private:
+            std::vector< std::uint8_t > & out;     //<! Código gerado.
+            std::vector< std::size_t > overflow_jumps; //<! Deslocamentos a apontar para a saída de overflow.
+            std::vector< std::size_t > zero_jumps;     //<! Deslocamentos a apontar para a saída de divisão por zero.
+
+            void bytes( std::initializer_list< std::uint8_t > b_ )
+            {  out.insert( out.end(), b_ ); }
+
+            void imm32( std::uint32_t v_ )
+            {
+                std::uint8_t raw[4];
+                std::memcpy( raw, &v_, 4 );
+                out.insert( out.end(), raw, raw + 4 );
+            }
+
+            //<! jcc rel32 com destino resolvido depois
+            void jump( std::uint8_t cc_, std::vector< std::size_t > & fixups_ )
+            {
+                bytes( { 0x0F, cc_ } );
+                fixups_.push_back( out.size() );
+                imm32( 0 );
+            }
+
+            //<! jo overflow; movsx eax, ax
+            void overflow_check16( void )
+            {
+                jump( 0x80, overflow_jumps );
+                bytes( { 0x0F, 0xBF, 0xC0 } );
+            }
+
+            //<! test ecx, ecx; jz divisão por zero
+            void zero_check( void )
+            {
+                bytes( { 0x85, 0xC9 } );
+                jump( 0x84, zero_jumps );
+            }
+
+            //<! Saída de erro: mov rsp, r8; mov eax, code; ret
+            void error_exit( const std::vector< std::size_t > & fixups_, std::uint8_t code_ )
+            {
+                if ( fixups_.empty() )
+                    return;
+
+                const std::size_t target = out.size();
+                for ( std::size_t at : fixups_ )
+                {
+                    auto rel = static_cast< std::int32_t >( target - ( at + 4 ) );
+                    std::memcpy( &out[at], &rel, 4 );
+                }
+                bytes( { 0x4C, 0x89, 0xC4, 0xB8 } );
+                imm32( code_ );
+                bytes( { 0xC3 } );
+            }
+    };
+
+    //<! Um Token no formato: tipo e operador, sem o valor
+    std::uint8_t shape_of( const Token & t_ )
+    {
+        return static_cast< std::uint8_t >( static_cast< unsigned >( t_.type ) << 3
+                                            | static_cast< unsigned >( t_.op ) );
+    }
+
+    //<! Hash do formato: FNV-1a sobre palavras com oito Tokens cada
+    std::uint64_t shape_hash( const Bares::token_list & postfix_ )
+    {
+        constexpr std::uint64_t PRIME = 1099511628211ull;
+        const Token * t = postfix_.data();
+        const std::size_t n = postfix_.size();
+        std::uint64_t h = 1469598103934665603ull ^ n;
+
+        std::size_t i = 0;
+        for ( ; i + 8 <= n; i += 8 )
+        {
+            std::uint64_t w = 0;
+            for ( std::size_t k = 0; k < 8; ++k )
+                w |= std::uint64_t( shape_of( t[ i + k ] ) ) << ( 8 * k );
+            h = ( h ^ w ) * PRIME;
+        }
+        std::uint64_t w = 0;
+        for ( std::size_t k = 0; i + k < n; ++k )
+            w |= std::uint64_t( shape_of( t[ i + k ] ) ) << ( 8 * k );
+        h = ( h ^ w ) * PRIME;
+
+        //Mistura final (fmix64 do MurmurHash3): com um só passo, os bits
+        //altos, que escolhem o contador, dependeriam de poucos Tokens
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdull;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ull;
+        h ^= h >> 33;
+        return h;
+    }
+
+    //<! Gera o código do formato; false se ele tiver algo sem suporte
+    bool generate( const std::vector< std::uint8_t > & signature_, std::vector< std::uint8_t > & code_ )
+    {
+        code_.clear();
+        Emitter e( code_ );
+        e.prologue();
+
+        std::size_t depth = 0;
+        std::size_t k = 0;
+        for ( std::uint8_t c : signature_ )
+        {
+            const auto type = static_cast< Token::token_t >( c >> 3 );
+            if ( type == Token::token_t::OPERAND )
+            {
+                e.push_literal( k++, depth > 0 );
+                ++depth;
+                continue;
+            }
+            if ( type != Token::token_t::OPERATOR )
+                return false; // Variáveis ficam com o interpretador.
+
+            e.operands();
+            --depth;
+            switch ( bc::opcode_of( static_cast< Token::operator_t >( c & 7 ) ) )
+            {
+                case bc::opcode_t::ADD : e.add(); break;
+                case bc::opcode_t::SUB : e.sub(); break;
+                case bc::opcode_t::MUL : e.mul(); break;
+                case bc::opcode_t::DIV : e.div(); break;
+                case bc::opcode_t::MOD : e.mod(); break;
+                default : return false; // "^" fica com o interpretador.
+            }
+        }
+
+        e.epilogue();
+        return true;
+    }
+}
+
+//<! Verifica se há gerador de código para esta plataforma
+bool jit::supported( void )
+{
+#ifdef BARES_JIT
+    return true;
+#else
+    return false;
+#endif
+}
+
+//<! Copia o código para a memória executável
+const void * jit::CodeBuffer::add( const std::vector< std::uint8_t > & code_ )
+{
+#ifdef BARES_JIT
+    if ( chunks.empty() or chunks.back().size - chunks.back().used < code_.size() )
+    {
+        const std::size_t page = static_cast< std::size_t >( ::sysconf( _SC_PAGESIZE ) );
+        std::size_t size = std::max( CHUNK_SIZE, code_.size() );
+        size = ( size + page - 1 ) / page * page;
+
+        void * p = ::mmap( nullptr, size, PROT_READ | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+        if ( p == MAP_FAILED )
+            return nullptr;
+        chunks.push_back( Chunk{ static_cast< std::uint8_t * >( p ), size, 0 } );
+    }
+
+    //A região só fica gravável durante a cópia
+    Chunk & c = chunks.back();
+    if ( ::mprotect( c.base, c.size, PROT_READ | PROT_WRITE ) != 0 )
+        return nullptr;
+    std::uint8_t * fn = c.base + c.used;
+    std::memcpy( fn, code_.data(), code_.size() );
+    if ( ::mprotect( c.base, c.size, PROT_READ | PROT_EXEC ) != 0 )
+        return nullptr;
+
+    //Próxima função alinhada em 16 bytes
+    c.used = std::min( c.size, ( c.used + code_.size() + 15 ) & ~std::size_t( 15 ) );
+    return fn;
+#else
+    ( void ) code_;
+    return nullptr;
+#endif
+}
+
+//<! Bytes de memória executável reservados
+std::size_t jit::CodeBuffer::capacity( void ) const
+{
+    std::size_t total = 0;
+    for ( const auto & c : chunks )
+        total += c.size;
+    return total;
+}
+
+//<! Desfaz todos os mapeamentos
+jit::CodeBuffer::~CodeBuffer()
+{
+#ifdef BARES_JIT
+    for ( const auto & c : chunks )
+        ::munmap( c.base, c.size );
+#endif
+}
+
+//<! Cria o cache
+jit::Cache::Cache( std::size_t threshold_, std::size_t max_functions_ )
+    : threshold( threshold_ )
+    , max_functions( max_functions_ )
+    , counters( std::size_t( 1 ) << COUNTER_BITS )
+{ /* empty */ }
+
+//<! Avalia a expressão com o código compilado do seu formato
+bool jit::Cache::run( const Bares::token_list & postfix_, Bares::Result & result_ )
+{
+    if ( not supported() or postfix_.size() > MAX_TOKENS )
+        return false;
+
+    const std::uint64_t hash = shape_hash( postfix_ );
+
+    auto it = entries.find( hash );
+    if ( it == entries.end() )
+    {
+        //Formato frio: só o contador (um formato novo toma o lugar do antigo)
+        Counter & c = counters[ hash >> ( 64 - COUNTER_BITS ) ];
+        if ( c.hash != hash )
+        {
+            c.hash = hash;
+            c.hits = 0;
+        }
+        if ( ++c.hits < threshold or entries.size() >= MAX_SHAPES )
+            return false;
+        c.hits = 0;
+
+        //Formato quente: compila uma única vez (ou o marca como sem suporte)
+        it = entries.emplace( hash, Entry() ).first;
+        Entry & e = it->second;
+        e.signature.reserve( postfix_.size() );
+        for ( const Token & t : postfix_ )
+            e.signature.push_back( shape_of( t ) );
+
+        const void * fn = nullptr;
+        if ( n_compiled < max_functions and generate( e.signature, code ) )
+            fn = buffer.add( code );
+        if ( fn == nullptr )
+            return false;
+        e.fn = reinterpret_cast< function_t >( const_cast< void * >( fn ) );
+        ++n_compiled;
+    }
+
+    const Entry & e = it->second;
+    if ( e.fn == nullptr or e.signature.size() != postfix_.size() )
+        return false;
+
+    //Confere o formato (colisão do hash) e separa os operandos
+    literals.clear();
+    for ( std::size_t i = 0; i < postfix_.size(); ++i )
+    {
+        const Token & t = postfix_[i];
+        if ( shape_of( t ) != e.signature[i] )
+            return false;
+        if ( t.type == Token::token_t::OPERAND )
+            literals.push_back( t.value );
+    }
+
+    std::int16_t value = 0;
+    auto code_b = static_cast< Bares::Result::code_t >( e.fn( literals.data(), &value ) );
+    result_ = Bares::Result( code_b == Bares::Result::OK ? value : 0, code_b );
+    return true;
+}
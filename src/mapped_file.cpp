@@ -0,0 +1,65 @@
+/**
+ * @file mapped_file.cpp
+ * @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+ * @date 18 Outubro 2026
+ * @brief Arquivo com a implementação da classe MappedFile.
+ */
+
+#include "mapped_file.h"
+
+#include <cerrno>     // errno
+#include <cstring>    // std::strerror
+#include <stdexcept>  // std::runtime_error
+#include <fcntl.h>    // open
+#include <sys/mman.h> // mmap, munmap, madvise
+#include <sys/stat.h> // fstat
+#include <unistd.h>   // close
+
+//<! Abre e mapeia o arquivo
+MappedFile::MappedFile( const std::string & path_ )
+    : m_data( nullptr )
+    , m_size( 0 )
+{
+    int fd = ::open( path_.c_str(), O_RDONLY );
+    if ( fd < 0 )
+        throw std::runtime_error( "MappedFile: " + path_ + ": " + std::strerror( errno ) );
+
+    struct stat st;
+    if ( ::fstat( fd, &st ) < 0 )
+    {
+        int err = errno;
+        ::close( fd );
+        throw std::runtime_error( "MappedFile: " + path_ + ": " + std::strerror( err ) );
+    }
+
+    m_size = static_cast< std::size_t >( st.st_size );
+    //Arquivo vazio: nada a mapear
+    if ( m_size > 0 )
+    {
+        void * p = ::mmap( nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+        if ( p == MAP_FAILED )
+        {
+            int err = errno;
+            ::close( fd );
+            throw std::runtime_error( "MappedFile: " + path_ + ": " + std::strerror( err ) );
+        }
+        ::madvise( p, m_size, MADV_SEQUENTIAL );
+        m_data = static_cast< const char * >( p );
+    }
+
+    //O mapeamento continua válido depois de fechar o descritor
+    ::close( fd );
+}
+
+//<! Desfaz o mapeamento
+MappedFile::~MappedFile()
+{
+    if ( m_data != nullptr )
+        ::munmap( const_cast< char * >( m_data ), m_size );
+}
+
+//<! Conteúdo do arquivo
+std::string_view MappedFile::view( void ) const
+{
+    return std::string_view( m_data, m_size );
+}
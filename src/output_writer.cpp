@@ -0,0 +1,222 @@
+/**
+ * @file output_writer.cpp
+ * @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+ * @date 18 Outubro 2026
+ * @brief Arquivo com a implementação da classe OutputWriter.
+ */
+
+#include "output_writer.h"
+
+#include <cerrno>   // errno
+#include <charconv> // std::to_chars
+#include <cstring>  // std::memcpy
+#include <unistd.h> // write
+
+#include "stats.h"  // stats::N_TOKENIZER_CODES, stats::N_BARES_CODES
+
+namespace {
+
+    /**
+     * @brief      Mensagem com a coluna entre prefix e suffix
+     */
+    struct Template
+    {
+        std::string_view prefix; //<! Texto antes da coluna.
+        std::string_view suffix; //<! Texto depois da coluna.
+    };
+
+    //<! Mensagens do Tokenizer, por Tokenizer::Result::code_t (OK não é usado)
+    constexpr Template text_parse[ stats::N_TOKENIZER_CODES ] = {
+        { "", "" },
+        { "Final inesperado de expressão na coluna (", ")!\n" },
+        { "Inteiro mal formado na coluna (", ")!\n" },
+        { "Faltando <termo> na coluna (", ")!\n" },
+        { "Símbolo inesperado após expressão válida encontrado na coluna (", ")!\n" },
+        { "Faltando símbolo \")\" na coluna (", ")!\n" },
+        { "Constante inteira fora do intervalo começando na coluna (", ")!\n" },
+        { "Variáveis demais na expressão, a partir da coluna (", ")!\n" }
+    };
+
+    //<! Mensagens do cálculo, por Bares::Result::code_t (OK não é usado)
+    constexpr std::string_view text_eval[ stats::N_BARES_CODES ] = {
+        "",
+        "Divisão por zero!\n",
+        "Erro de sobrecarga numérica!\n"
+    };
+
+    //<! Mensagem dos códigos desconhecidos
+    constexpr std::string_view text_unknown = "Erro sem tratamento!\n";
+
+    //<! Objetos JSON dos erros do Tokenizer, com a coluna no fim
+    constexpr std::string_view json_parse[ stats::N_TOKENIZER_CODES ] = {
+        "{\"code\":\"OK\",\"column\":",
+        "{\"code\":\"UNEXPECTED_END_OF_EXPRESSION\",\"column\":",
+        "{\"code\":\"ILL_FORMED_INTEGER\",\"column\":",
+        "{\"code\":\"MISSING_TERM\",\"column\":",
+        "{\"code\":\"EXTRANEOUS_SYMBOL\",\"column\":",
+        "{\"code\":\"MISSING_CLOSING_PARENTHESIS\",\"column\":",
+        "{\"code\":\"INTEGER_OUT_OF_RANGE\",\"column\":",
+        "{\"code\":\"TOO_MANY_VARIABLES\",\"column\":"
+    };
+
+    //<! Objetos JSON dos resultados do cálculo (o valor vem depois de OK)
+    constexpr std::string_view json_eval[ stats::N_BARES_CODES ] = {
+        "{\"code\":\"OK\",\"value\":",
+        "{\"code\":\"DIVISION_BY_ZERO\"}\n",
+        "{\"code\":\"NUMERIC_OVERFLOW\"}\n"
+    };
+
+    //<! Objeto JSON dos códigos desconhecidos
+    constexpr std::string_view json_unknown = "{\"code\":\"UNKNOWN\"}\n";
+}
+
+//<! Cria o escritor
+OutputWriter::OutputWriter( format_t format_, int fd_ )
+    : fmt( format_ )
+    , fd( fd_ )
+    , failed( false )
+{
+    //Sem descritor o buffer cresce conforme o uso
+    if ( fd >= 0 )
+        buffer.reserve( FLUSH_SIZE + 4096 );
+}
+
+//<! Escreve o que restar no descritor
+OutputWriter::~OutputWriter()
+{
+    flush();
+}
+
+//<! Escreve o resultado de um cálculo
+void OutputWriter::result( const Bares::Result & result_ )
+{
+    const auto code = static_cast< std::size_t >( result_.type_b );
+    switch ( fmt )
+    {
+        case format_t::TEXT:
+            if ( result_.type_b == Bares::Result::OK )
+            {
+                append_int( result_.value_b );
+                buffer.push_back( '\n' );
+            }
+            else
+                buffer.append( code < stats::N_BARES_CODES ? text_eval[ code ] : text_unknown );
+            break;
+
+        case format_t::JSONL:
+            if ( result_.type_b == Bares::Result::OK )
+            {
+                buffer.append( json_eval[ 0 ] );
+                append_int( result_.value_b );
+                buffer.append( "}\n" );
+            }
+            else
+                buffer.append( code < stats::N_BARES_CODES ? json_eval[ code ] : json_unknown );
+            break;
+
+        case format_t::BINARY:
+            if ( result_.type_b == Bares::Result::OK )
+                append_record( result_.value_b, 0, OutputRecord::VALUE, 0 );
+            else
+                append_record( 0, 0, OutputRecord::EVAL_ERROR, static_cast< std::uint8_t >( code ) );
+            break;
+    }
+    maybe_flush();
+}
+
+//<! Escreve o erro de parsing de uma expressão
+void OutputWriter::parse_error( const Tokenizer::Result & result_ )
+{
+    const auto code = static_cast< std::size_t >( result_.type );
+    const bool known = code > 0 and code < stats::N_TOKENIZER_CODES;
+    switch ( fmt )
+    {
+        case format_t::TEXT:
+            if ( not known )
+            {
+                buffer.append( text_unknown );
+                break;
+            }
+            buffer.append( text_parse[ code ].prefix );
+            append_int( static_cast< std::int64_t >( result_.at_col ) );
+            buffer.append( text_parse[ code ].suffix );
+            break;
+
+        case format_t::JSONL:
+            if ( not known )
+            {
+                buffer.append( json_unknown );
+                break;
+            }
+            buffer.append( json_parse[ code ] );
+            append_int( static_cast< std::int64_t >( result_.at_col ) );
+            buffer.append( "}\n" );
+            break;
+
+        case format_t::BINARY:
+            append_record( 0, static_cast< std::uint32_t >( result_.at_col ), OutputRecord::PARSE_ERROR,
+                           static_cast< std::uint8_t >( code ) );
+            break;
+    }
+    maybe_flush();
+}
+
+//<! Acrescenta bytes já formatados
+void OutputWriter::raw( std::string_view bytes_ )
+{
+    buffer.append( bytes_ );
+    maybe_flush();
+}
+
+//<! Escreve o buffer no descritor
+bool OutputWriter::flush( void )
+{
+    if ( fd < 0 )
+        return true;
+
+    //Escritas parciais continuam de onde pararam
+    std::size_t done = 0;
+    while ( not failed and done < buffer.size() )
+    {
+        ssize_t n = ::write( fd, buffer.data() + done, buffer.size() - done );
+        if ( n < 0 and errno == EINTR )
+            continue;
+        if ( n <= 0 )
+            failed = true;
+        else
+            done += static_cast< std::size_t >( n );
+    }
+    buffer.clear();
+    return not failed;
+}
+
+//<! Converte o nome de um formato
+bool OutputWriter::parse_format( std::string_view name_, format_t & format_ )
+{
+    if ( name_ == "text" )
+        format_ = format_t::TEXT;
+    else if ( name_ == "jsonl" )
+        format_ = format_t::JSONL;
+    else if ( name_ == "binary" )
+        format_ = format_t::BINARY;
+    else
+        return false;
+    return true;
+}
+
+//<! Acrescenta um inteiro em decimal
+void OutputWriter::append_int( std::int64_t v_ )
+{
+    char digits[ 24 ];
+    auto end = std::to_chars( digits, digits + sizeof( digits ), v_ ).ptr;
+    buffer.append( digits, static_cast< std::size_t >( end - digits ) );
+}
+
+//<! Acrescenta um registro binário
+void OutputWriter::append_record( std::int64_t value_, std::uint32_t column_, std::uint8_t kind_, std::uint8_t code_ )
+{
+    OutputRecord r{ value_, column_, kind_, code_, 0 };
+    const std::size_t at = buffer.size();
+    buffer.resize( at + sizeof( r ) );
+    std::memcpy( &buffer[ at ], &r, sizeof( r ) );
+}
@@ -0,0 +1,229 @@
+/**
+ * @file parallel_tokenizer.cpp
+ * @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+ * @date 18 Outubro 2026
+ * @brief Arquivo com a implementação da classe ParallelTokenizer.
+ */
+
+#include "parallel_tokenizer.h"
+
+#include <algorithm> // std::min, std::max, std::copy
+
+namespace {
+
+    using op_t = TokenKinds::operator_t;
+
+    //<! Tamanho mínimo de um bloco, em bytes; linhas menores que dois blocos são lidas em sequência.
+    constexpr std::size_t MIN_CHUNK = 64 * 1024;
+
+    //<! Blocos por trabalhador (sobra para o roubo equilibrar).
+    constexpr std::size_t CHUNKS_PER_WORKER = 4;
+
+    //<! Módulo acima de qualquer constante de 16 bits: os dígitos restantes são ignorados.
+    constexpr std::uint32_t SATURATED = 100000;
+
+    //<! Operador de um caractere (NONE se não for um operador)
+    op_t operator_of( char c_ )
+    {
+        switch ( c_ )
+        {
+            case '+' : return op_t::PLUS;
+            case '-' : return op_t::MINUS;
+            case '*' : return op_t::ASTERISK;
+            case '/' : return op_t::SLASH;
+            case '%' : return op_t::MOD;
+            case '^' : return op_t::CARRET;
+            default  : return op_t::NONE;
+        }
+    }
+
+    //<! Caracteres após os quais a expressão pode ser dividida
+    bool is_boundary( char c_ )
+    {
+        return c_ == '+' or c_ == '*' or c_ == '/' or c_ == '%' or c_ == '^' or c_ == '(' or c_ == ')';
+    }
+
+    bool is_ws( char c_ )
+    {  return c_ == ' ' or c_ == '\t'; }
+
+    bool is_digit( char c_ )
+    {  return c_ >= '0' and c_ <= '9'; }
+}
+
+//<! Faz o parsing da expressão
+ParallelTokenizer::Result ParallelTokenizer::parse( std::string_view e_ )
+{
+    auto fallback = [&]{
+        tokens = &sequential.get_tokens();
+        return sequential.parse( e_ );
+    };
+
+    if ( not split( e_ ) )
+        return fallback();
+
+    //Cada bloco em uma tarefa
+    {
+        TaskGroup g( pool );
+        for ( std::size_t k = 1; k < chunks.size(); ++k )
+            g.run( [this, e_, k]{ lex( e_, chunks[k] ); } );
+        lex( e_, chunks[0] );
+        g.wait();
+    }
+
+    //Junção: cada bloco precisa terminar no estado em que o seguinte começa,
+    //e a profundidade de entrada de cada bloco (soma de prefixos) mais o
+    //mínimo dentro dele nunca pode ficar negativa
+    long depth = 0;
+    std::size_t count = 0;
+    for ( std::size_t k = 0; k < chunks.size(); ++k )
+    {
+        const Chunk & c = chunks[k];
+        if ( not c.ok or ( k + 1 < chunks.size() and c.leave != chunks[ k + 1 ].enter ) )
+            return fallback();
+        if ( depth + c.min_depth < 0 )
+            return fallback();
+        depth += c.depth;
+        chunks[k].offset = count;
+        count += c.tokens.size();
+    }
+    if ( depth != 0 or chunks.back().leave != state_t::OPERATOR )
+        return fallback();
+
+    //Cópia dos Tokens para a lista final, também em paralelo
+    merged.resize( count );
+    {
+        TaskGroup g( pool );
+        for ( std::size_t k = 1; k < chunks.size(); ++k )
+            g.run( [this, k]{ std::copy( chunks[k].tokens.begin(), chunks[k].tokens.end(), merged.begin() + chunks[k].offset ); } );
+        std::copy( chunks[0].tokens.begin(), chunks[0].tokens.end(), merged.begin() );
+        g.wait();
+    }
+
+    tokens = &merged;
+    return Result( Result::OK );
+}
+
+//<! Divide a expressão em blocos
+bool ParallelTokenizer::split( std::string_view e_ )
+{
+    const std::size_t n = std::min( e_.size() / MIN_CHUNK, CHUNKS_PER_WORKER * pool.size() );
+    if ( n < 2 )
+        return false;
+
+    //Cada divisão avança até logo após o próximo caractere de fronteira
+    std::size_t used = 0;
+    std::size_t begin = 0;
+    for ( std::size_t k = 1; k < n and begin < e_.size(); ++k )
+    {
+        std::size_t end = std::max( begin + 1, e_.size() / n * k );
+        while ( end < e_.size() and not is_boundary( e_[ end - 1 ] ) )
+            ++end;
+        if ( end >= e_.size() )
+            break;
+
+        if ( used == chunks.size() )
+            chunks.emplace_back();
+        chunks[ used ].begin = begin;
+        chunks[ used ].end = end;
+        ++used;
+        begin = end;
+    }
+    if ( used == chunks.size() )
+        chunks.emplace_back();
+    chunks[ used ].begin = begin;
+    chunks[ used ].end = e_.size();
+    ++used;
+
+    //O primeiro bloco espera um termo; os outros, o que vem após a fronteira
+    chunks.resize( used );
+    chunks[0].enter = state_t::TERM;
+    for ( std::size_t k = 1; k < used; ++k )
+        chunks[k].enter = e_[ chunks[k].begin - 1 ] == ')' ? state_t::OPERATOR : state_t::TERM;
+
+    return used >= 2;
+}
+
+//<! Lê um bloco
+void ParallelTokenizer::lex( std::string_view e_, Chunk & c_ )
+{
+    const char * s = e_.data();
+    std::size_t i = c_.begin;
+    const std::size_t end = c_.end;
+    state_t state = c_.enter;
+    long depth = 0, min_depth = 0;
+
+    c_.ok = false;
+    c_.tokens.clear();
+
+    while ( true )
+    {
+        while ( i < end and is_ws( s[i] ) )
+            ++i;
+        if ( i == end )
+            break;
+
+        const auto col = static_cast< std::uint32_t >( i + 1 );
+        char c = s[i];
+
+        if ( state == state_t::OPERATOR )
+        {
+            const op_t op = operator_of( c );
+            if ( op != op_t::NONE )
+            {
+                c_.tokens.emplace_back( TokenKinds::token_t::OPERATOR, op, 0, col );
+                state = state_t::TERM;
+            }
+            else if ( c == ')' )
+            {
+                c_.tokens.emplace_back( TokenKinds::token_t::CLOSING_SCOPE, op_t::NONE, 0, col );
+                min_depth = std::min( min_depth, --depth );
+            }
+            else
+                return;
+            ++i;
+            continue;
+        }
+
+        //Termo: "(", "0" ou {"-"},<natural_number> (com espaços entre os "-")
+        if ( c == '(' )
+        {
+            c_.tokens.emplace_back( TokenKinds::token_t::OPENING_SCOPE, op_t::NONE, 0, col );
+            ++depth;
+            ++i;
+            continue;
+        }
+
+        Token::value_type v = 0;
+        if ( c == '0' )
+            ++i; //"0" é sempre uma constante inteira ("05" dá erro no operador)
+        else
+        {
+            bool negative = false;
+            while ( c == '-' )
+            {
+                negative = not negative;
+                ++i;
+                while ( i < end and is_ws( s[i] ) )
+                    ++i;
+                if ( i == end )
+                    return;
+                c = s[i];
+            }
+            if ( c < '1' or c > '9' )
+                return;
+
+            std::uint32_t magnitude = 0;
+            for ( ; i < end and is_digit( s[i] ); ++i )
+                magnitude = std::min( magnitude * 10 + std::uint32_t( s[i] - '0' ), SATURATED );
+            if ( arith::from_magnitude( magnitude, negative, v ) )
+                return;
+        }
+        c_.tokens.emplace_back( TokenKinds::token_t::OPERAND, op_t::NONE, v, col );
+        state = state_t::OPERATOR;
+    }
+
+    c_.leave = state;
+    c_.depth = depth;
+    c_.min_depth = min_depth;
+    c_.ok = true;
+}
@@ -0,0 +1,66 @@
+/**
+ * @file reorder_buffer.cpp
+ * @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+ * @date 18 Outubro 2026
+ * @brief Arquivo com a implementação do buffer de reordenação.
+ */
+
+#include "reorder_buffer.h"
+
+#include <limits> // std::numeric_limits
+
+//<! Cria o buffer
+ReorderBuffer::ReorderBuffer( std::size_t capacity_ )
+    : slots( capacity_ == 0 ? 1 : capacity_ )
+    , next( 0 )
+    , total( std::numeric_limits< std::size_t >::max() )
+{ /* empty */ }
+
+//<! Bloqueia até que o bloco seq caiba na janela
+void ReorderBuffer::wait_for_slot( std::size_t seq_ )
+{
+    std::unique_lock< std::mutex > lk( m );
+    cv.wait( lk, [&]{ return seq_ < next + slots.size(); } );
+}
+
+//<! Deposita um bloco pronto
+void ReorderBuffer::put( std::size_t seq_, std::string data_ )
+{
+    {
+        std::lock_guard< std::mutex > lk( m );
+        Slot & s = slots[ seq_ % slots.size() ];
+        s.data = std::move( data_ );
+        s.ready = true;
+    }
+    cv.notify_all();
+}
+
+//<! Informa o total de blocos que serão produzidos
+void ReorderBuffer::finish( std::size_t total_ )
+{
+    {
+        std::lock_guard< std::mutex > lk( m );
+        total = total_;
+    }
+    cv.notify_all();
+}
+
+//<! Retira o próximo bloco na ordem de entrada
+bool ReorderBuffer::pop( std::string & data_ )
+{
+    std::unique_lock< std::mutex > lk( m );
+    Slot & s = slots[ next % slots.size() ];
+    cv.wait( lk, [&]{ return s.ready or next >= total; } );
+
+    if ( not s.ready )
+        return false;
+
+    data_.swap( s.data );
+    s.data.clear();
+    s.ready = false;
+    ++next;
+
+    lk.unlock();
+    cv.notify_all();
+    return true;
+}
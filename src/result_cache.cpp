@@ -0,0 +1,89 @@
+/**
+ * @file result_cache.cpp
+ * @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+ * @date 18 Outubro 2026
+ * @brief Arquivo com a implementação do cache LRU de resultados.
+ */
+
+#include "result_cache.h"
+
+//<! Cria o cache
+ResultCache::ResultCache( std::size_t capacity_ )
+    : capacity( capacity_ )
+    , used( 0 )
+    , n_hits( 0 )
+    , n_misses( 0 )
+{ /* empty */ }
+
+//<! Monta a chave normalizada de uma lista de Tokens
+void ResultCache::make_key( const std::vector< Token > & tokens_, std::string & key_ )
+{
+    key_.resize( 4 * tokens_.size() );
+    char * p = &key_[0];
+    for ( const auto & t : tokens_ )
+    {
+        //A coluna fica de fora: ela é a única parte que depende dos espaços
+        auto v = static_cast< std::uint16_t >( t.value );
+        *p++ = static_cast< char >( t.type );
+        *p++ = static_cast< char >( t.op );
+        *p++ = static_cast< char >( v & 0xFF );
+        *p++ = static_cast< char >( v >> 8 );
+    }
+}
+
+//<! Procura a chave e, se encontrada, a torna a mais recente
+const Bares::Result * ResultCache::find( std::string_view key_ )
+{
+    auto it = index.find( key_ );
+    if ( it == index.end() )
+    {
+        ++n_misses;
+        return nullptr;
+    }
+
+    ++n_hits;
+    entries.splice( entries.begin(), entries, it->second );
+    return &it->second->result;
+}
+
+//<! Guarda o resultado, descartando as entradas menos recentes
+void ResultCache::insert( std::string_view key_, const Bares::Result & result_ )
+{
+    const std::size_t c = cost( key_ );
+    if ( c > capacity or index.count( key_ ) )
+        return;
+
+    while ( used + c > capacity )
+    {
+        const Entry & last = entries.back();
+        used -= cost( last.key );
+        index.erase( last.key );
+        entries.pop_back();
+    }
+
+    entries.push_front( Entry{ std::string( key_ ), result_ } );
+    index.emplace( entries.front().key, entries.begin() );
+    used += c;
+}
+
+//<! Memória estimada ocupada por uma entrada
+std::size_t ResultCache::cost( std::string_view key_ )
+{
+    //Nó da lista (dois ponteiros + Entry), nó da tabela (chave, iterador,
+    //hash e próximo) e o texto da chave fora do buffer interno da string
+    return 2 * sizeof( void * ) + sizeof( Entry )
+         + 2 * sizeof( void * ) + sizeof( std::string_view ) + sizeof( std::size_t )
+         + key_.size();
+}
+
+//<! Hash FNV-1a de 64 bits
+std::size_t ResultCache::KeyHash::operator()( std::string_view key_ ) const
+{
+    std::uint64_t h = 14695981039346656037ull;
+    for ( char c : key_ )
+    {
+        h ^= static_cast< unsigned char >( c );
+        h *= 1099511628211ull;
+    }
+    return static_cast< std::size_t >( h );
+}
@@ -0,0 +1,378 @@
+/**
+ * @file server.cpp
+ * @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+ * @date 18 Outubro 2026
+ * @brief Arquivo com a implementação do modo servidor e do cliente.
+ */
+
+#include "server.h"
+
+#include <cerrno>        // errno
+#include <cstdint>       // std::uint32_t, std::uint64_t
+#include <cstring>       // std::strerror, std::memcpy
+#include <stdexcept>     // std::runtime_error
+#include <string_view>   // std::string_view
+#include <thread>        // std::thread
+#include <unordered_map> // std::unordered_map
+#include <vector>        // std::vector
+#include <sys/epoll.h>   // epoll_create1, epoll_ctl, epoll_wait
+#include <sys/eventfd.h> // eventfd
+#include <sys/socket.h>  // socket, bind, listen, accept4, send, shutdown
+#include <sys/stat.h>    // lstat
+#include <sys/un.h>      // sockaddr_un
+#include <unistd.h>      // read, write, close, unlink
+
+namespace {
+
+    /**
+     * @brief      Estado de um cliente
+     */
+    struct Connection
+    {
+        int fd = -1;             //<! Socket do cliente.
+        std::uint32_t mask = 0;  //<! Eventos registrados no epoll.
+        bool eof = false;        //<! O cliente fechou a escrita.
+        std::string in;          //<! Bytes recebidos que ainda não formam uma linha.
+        std::string out;         //<! Respostas ainda não enviadas.
+        std::size_t sent = 0;    //<! Bytes de out já enviados.
+    };
+
+    //<! Mensagem de erro de uma chamada de sistema
+    std::runtime_error sys_error( const std::string & what_ )
+    {  return std::runtime_error( what_ + ": " + std::strerror( errno ) ); }
+
+    //<! Preenche o endereço do socket
+    sockaddr_un socket_address( const std::string & path_ )
+    {
+        sockaddr_un addr;
+        std::memset( &addr, 0, sizeof( addr ) );
+        addr.sun_family = AF_UNIX;
+        if ( path_.empty() or path_.size() >= sizeof( addr.sun_path ) )
+            throw std::runtime_error( "Server: caminho de socket inválido: " + path_ );
+        std::memcpy( addr.sun_path, path_.data(), path_.size() );
+        return addr;
+    }
+
+    //<! Avalia as linhas completas recebidas (e a última, se o cliente terminou)
+    void serve_lines( Connection & c_, Evaluator & evaluator_, OutputWriter & out_ )
+    {
+        std::string_view in( c_.in );
+        std::size_t begin = 0;
+        for ( std::size_t nl = in.find( '\n' ); nl != std::string_view::npos; nl = in.find( '\n', begin ) )
+        {
+            evaluator_.eval( in.substr( begin, nl - begin ), out_ );
+            begin = nl + 1;
+        }
+
+        //Última linha sem '\n'
+        if ( c_.eof and begin < in.size() )
+        {
+            evaluator_.eval( in.substr( begin ), out_ );
+            begin = in.size();
+        }
+        c_.in.erase( 0, begin );
+
+        c_.out.append( out_.view() );
+        out_.clear();
+    }
+
+    //<! Envia o que for possível sem bloquear; false se a conexão falhou
+    bool flush( Connection & c_ )
+    {
+        while ( c_.sent < c_.out.size() )
+        {
+            ssize_t n = ::send( c_.fd, c_.out.data() + c_.sent, c_.out.size() - c_.sent, MSG_NOSIGNAL );
+            if ( n < 0 and errno == EINTR )
+                continue;
+            if ( n < 0 )
+                return errno == EAGAIN or errno == EWOULDBLOCK;
+            c_.sent += static_cast< std::size_t >( n );
+        }
+        c_.out.clear();
+        c_.sent = 0;
+        return true;
+    }
+
+    //<! Lê o que estiver disponível; false se a conexão falhou
+    bool receive( Connection & c_, std::size_t read_size_ )
+    {
+        //Limite de leituras por evento, para não monopolizar a thread
+        for ( int i = 0; i < 16; ++i )
+        {
+            std::size_t old = c_.in.size();
+            c_.in.resize( old + read_size_ );
+            ssize_t n = ::read( c_.fd, &c_.in[old], read_size_ );
+            c_.in.resize( old + static_cast< std::size_t >( n > 0 ? n : 0 ) );
+
+            if ( n == 0 )
+            {
+                c_.eof = true;
+                return true;
+            }
+            if ( n < 0 and errno == EINTR )
+                continue;
+            if ( n < 0 )
+                return errno == EAGAIN or errno == EWOULDBLOCK;
+        }
+        return true;
+    }
+}
+
+//<! Cria o socket e começa a escutar
+Server::Server( const std::string & path_, std::size_t n_threads_, const EvalOptions & options_ )
+    : path( path_ )
+    , n_threads( n_threads_ > 0 ? n_threads_ : 1 )
+    , options( options_ )
+    , listen_fd( -1 )
+    , stop_fd( -1 )
+{
+    sockaddr_un addr = socket_address( path );
+
+    //Só um socket antigo é removido; outro tipo de arquivo é um erro
+    struct stat st;
+    if ( ::lstat( path.c_str(), &st ) == 0 )
+    {
+        if ( not S_ISSOCK( st.st_mode ) )
+            throw std::runtime_error( "Server: " + path + ": arquivo existente não é um socket" );
+        ::unlink( path.c_str() );
+    }
+
+    listen_fd = ::socket( AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0 );
+    if ( listen_fd < 0 )
+        throw sys_error( "Server: socket" );
+
+    if ( ::bind( listen_fd, reinterpret_cast< sockaddr * >( &addr ), sizeof( addr ) ) < 0
+         or ::listen( listen_fd, SOMAXCONN ) < 0 )
+    {
+        auto e = sys_error( "Server: " + path );
+        ::close( listen_fd );
+        throw e;
+    }
+
+    stop_fd = ::eventfd( 0, EFD_NONBLOCK | EFD_CLOEXEC );
+    if ( stop_fd < 0 )
+    {
+        auto e = sys_error( "Server: eventfd" );
+        ::close( listen_fd );
+        ::unlink( path.c_str() );
+        throw e;
+    }
+}
+
+//<! Fecha as conexões e remove o arquivo do socket
+Server::~Server()
+{
+    ::close( listen_fd );
+    ::close( stop_fd );
+    ::unlink( path.c_str() );
+}
+
+//<! Atende os clientes até stop()
+void Server::run( void )
+{
+    std::vector< std::thread > threads;
+    for ( std::size_t i = 1; i < n_threads; ++i )
+        threads.emplace_back( &Server::worker, this );
+
+    worker();
+
+    for ( auto & t : threads )
+        t.join();
+}
+
+//<! Pede o término de run()
+void Server::stop( void )
+{
+    //O eventfd nunca é lido: continua sinalizado para todas as threads
+    std::uint64_t one = 1;
+    ssize_t n = ::write( stop_fd, &one, sizeof( one ) );
+    ( void ) n;
+}
+
+//<! Laço de uma thread trabalhadora
+void Server::worker( void )
+{
+    int ep = ::epoll_create1( EPOLL_CLOEXEC );
+    if ( ep < 0 )
+        return;
+
+    epoll_event ev;
+    ev.events = EPOLLIN | EPOLLEXCLUSIVE;
+    ev.data.fd = listen_fd;
+    ::epoll_ctl( ep, EPOLL_CTL_ADD, listen_fd, &ev );
+    ev.events = EPOLLIN;
+    ev.data.fd = stop_fd;
+    ::epoll_ctl( ep, EPOLL_CTL_ADD, stop_fd, &ev );
+
+    Evaluator evaluator( options ); // Aquecido entre as requisições de todos os clientes.
+    OutputWriter out( options.output );
+    std::unordered_map< int, Connection > connections;
+    epoll_event events[ MAX_EVENTS ];
+
+    auto close_connection = [&]( int fd_ ){
+        ::epoll_ctl( ep, EPOLL_CTL_DEL, fd_, nullptr );
+        ::close( fd_ );
+        connections.erase( fd_ );
+    };
+
+    bool running = true;
+    while ( running )
+    {
+        int n = ::epoll_wait( ep, events, MAX_EVENTS, -1 );
+        if ( n < 0 and errno == EINTR )
+            continue;
+        if ( n < 0 )
+            break;
+
+        for ( int i = 0; i < n; ++i )
+        {
+            int fd = events[i].data.fd;
+            if ( fd == stop_fd )
+            {
+                running = false;
+                break;
+            }
+
+            if ( fd == listen_fd )
+            {
+                //Aceita todas as conexões pendentes
+                int client;
+                while ( ( client = ::accept4( listen_fd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC ) ) >= 0 )
+                {
+                    Connection & c = connections[ client ];
+                    c.fd = client;
+                    c.mask = EPOLLIN | EPOLLRDHUP;
+                    ev.events = c.mask;
+                    ev.data.fd = client;
+                    ::epoll_ctl( ep, EPOLL_CTL_ADD, client, &ev );
+                }
+                continue;
+            }
+
+            auto it = connections.find( fd );
+            if ( it == connections.end() )
+                continue;
+            Connection & c = it->second;
+
+            bool ok = not ( events[i].events & EPOLLERR );
+            if ( ok and not c.eof and ( events[i].events & ( EPOLLIN | EPOLLRDHUP | EPOLLHUP ) ) )
+            {
+                ok = receive( c, READ_SIZE );
+                serve_lines( c, evaluator, out );
+
+                //Linha longa demais: para de ler e fecha após as respostas pendentes
+                if ( c.in.size() > IN_MAX )
+                {
+                    std::string().swap( c.in );
+                    c.eof = true;
+                }
+            }
+            ok = ok and flush( c );
+
+            std::size_t pending = c.out.size() - c.sent;
+            if ( not ok or ( c.eof and pending == 0 ) )
+            {
+                close_connection( fd );
+                continue;
+            }
+
+            //Respostas acumuladas suspendem a leitura até serem enviadas
+            std::uint32_t mask = 0;
+            if ( not c.eof and pending < OUT_HIGH )
+                mask |= EPOLLIN | EPOLLRDHUP;
+            if ( pending > 0 )
+                mask |= EPOLLOUT;
+            if ( mask != c.mask )
+            {
+                c.mask = mask;
+                ev.events = mask;
+                ev.data.fd = fd;
+                ::epoll_ctl( ep, EPOLL_CTL_MOD, fd, &ev );
+            }
+        }
+    }
+
+    for ( auto & entry : connections )
+        ::close( entry.first );
+    ::close( ep );
+}
+
+//<! Cliente: envia a entrada ao servidor e escreve as respostas
+bool run_client( const std::string & path_, int in_fd_, int out_fd_ )
+{
+    sockaddr_un addr = socket_address( path_ );
+    int fd = ::socket( AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0 );
+    if ( fd < 0 )
+        throw sys_error( "Client: socket" );
+    if ( ::connect( fd, reinterpret_cast< sockaddr * >( &addr ), sizeof( addr ) ) < 0 )
+    {
+        auto e = sys_error( "Client: " + path_ );
+        ::close( fd );
+        throw e;
+    }
+
+    //Envio e recepção em paralelo: o servidor responde antes do fim da entrada
+    bool sent_ok = true;
+    std::thread sender( [&]{
+        std::vector< char > chunk( 64 * 1024 );
+        while ( sent_ok )
+        {
+            ssize_t n = ::read( in_fd_, chunk.data(), chunk.size() );
+            if ( n < 0 and errno == EINTR )
+                continue;
+            if ( n <= 0 )
+            {
+                sent_ok = ( n == 0 );
+                break;
+            }
+            for ( ssize_t done = 0; done < n; )
+            {
+                ssize_t w = ::send( fd, chunk.data() + done, static_cast< std::size_t >( n - done ), MSG_NOSIGNAL );
+                if ( w < 0 and errno == EINTR )
+                    continue;
+                if ( w < 0 )
+                {
+                    sent_ok = false;
+                    break;
+                }
+                done += w;
+            }
+        }
+        ::shutdown( fd, SHUT_WR );
+    });
+
+    bool received_ok = true;
+    std::vector< char > chunk( 64 * 1024 );
+    while ( true )
+    {
+        ssize_t n = ::read( fd, chunk.data(), chunk.size() );
+        if ( n < 0 and errno == EINTR )
+            continue;
+        if ( n <= 0 )
+        {
+            received_ok = ( n == 0 );
+            break;
+        }
+        for ( ssize_t done = 0; done < n; )
+        {
+            ssize_t w = ::write( out_fd_, chunk.data() + done, static_cast< std::size_t >( n - done ) );
+            if ( w < 0 and errno == EINTR )
+                continue;
+            if ( w < 0 )
+            {
+                received_ok = false;
+                break;
+            }
+            done += w;
+        }
+        if ( not received_ok )
+            break;
+    }
+
+    //Sem leitor, o envio não tem mais para onde ir
+    if ( not received_ok )
+        ::shutdown( fd, SHUT_RDWR );
+    sender.join();
+    ::close( fd );
+    return sent_ok and received_ok;
+}
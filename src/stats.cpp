@@ -0,0 +1,281 @@
+/**
+ * @file stats.cpp
+ * @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+ * @date 18 Outubro 2026
+ * @brief Arquivo com a implementação das estatísticas de execução.
+ */
+
+#include "stats.h"
+
+#include <cstdio>   // std::rename
+#include <fstream>  // std::ofstream
+#include <iostream> // std::cerr
+
+namespace {
+    //<! Nomes dos códigos de Tokenizer::Result::code_t
+    const char * const tokenizer_names[ stats::N_TOKENIZER_CODES ] = {
+        "OK", "UNEXPECTED_END_OF_EXPRESSION", "ILL_FORMED_INTEGER", "MISSING_TERM",
+        "EXTRANEOUS_SYMBOL", "MISSING_CLOSING_PARENTHESIS", "INTEGER_OUT_OF_RANGE",
+        "TOO_MANY_VARIABLES"
+    };
+
+    //<! Nomes dos códigos de Bares::Result::code_t
+    const char * const bares_names[ stats::N_BARES_CODES ] = {
+        "OK", "DIVISION_BY_ZERO", "NUMERIC_OVERFLOW"
+    };
+
+    //<! Nomes dos estágios
+    const char * const stage_names[ stats::N_STAGES ] = {
+        "tokenize", "infix_to_postfix", "evaluate", "output", "fused"
+    };
+
+    //<! Incremento feito pelo único escritor (sem read-modify-write atômico)
+    inline void bump( std::atomic< std::uint64_t > & a_, std::uint64_t v_ = 1 )
+    {
+        a_.store( a_.load( std::memory_order_relaxed ) + v_, std::memory_order_relaxed );
+    }
+
+    //<! Limite superior do balde k
+    std::uint64_t bucket_bound( std::size_t k_ )
+    {
+        return k_ == 0 ? 0 : ( std::uint64_t(1) << k_ ) - 1;
+    }
+
+    //<! Copia um histograma atômico
+    void add_hist( stats::Snapshot::Hist & h_, const stats::Histogram & src_ )
+    {
+        for ( std::size_t k = 0; k < stats::N_BUCKETS; ++k )
+            h_.buckets[k] += src_.buckets[k].load( std::memory_order_relaxed );
+        h_.count += src_.count.load( std::memory_order_relaxed );
+        h_.sum += src_.sum.load( std::memory_order_relaxed );
+    }
+
+    //<! Histograma em JSON
+    void hist_json( std::ostream & os_, const stats::Snapshot::Hist & h_ )
+    {
+        os_ << "{\"count\":" << h_.count << ",\"sum\":" << h_.sum
+            << ",\"p50\":" << h_.quantile( 0.50 ) << ",\"p90\":" << h_.quantile( 0.90 )
+            << ",\"p99\":" << h_.quantile( 0.99 ) << ",\"max\":" << h_.quantile( 1.0 ) << '}';
+    }
+
+    //<! Histograma no formato do Prometheus; scale_ converte a unidade dos baldes
+    void hist_prom( std::ostream & os_, const char * name_, const std::string & labels_,
+                    const stats::Snapshot::Hist & h_, double scale_ )
+    {
+        std::size_t last = 0;
+        for ( std::size_t k = 0; k < stats::N_BUCKETS; ++k )
+            if ( h_.buckets[k] )
+                last = k;
+
+        const std::string sep = labels_.empty() ? "" : ",";
+        std::uint64_t cumulative = 0;
+        for ( std::size_t k = 0; k <= last; ++k )
+        {
+            cumulative += h_.buckets[k];
+            os_ << name_ << "_bucket{" << labels_ << sep << "le=\"" << double( bucket_bound( k ) ) * scale_
+                << "\"} " << cumulative << '\n';
+        }
+        os_ << name_ << "_bucket{" << labels_ << sep << "le=\"+Inf\"} " << h_.count << '\n';
+        os_ << name_ << "_sum" << ( labels_.empty() ? "" : "{" + labels_ + "}" ) << ' ' << double( h_.sum ) * scale_ << '\n';
+        os_ << name_ << "_count" << ( labels_.empty() ? "" : "{" + labels_ + "}" ) << ' ' << h_.count << '\n';
+    }
+}
+
+//<! Registra uma amostra
+void stats::Histogram::record( std::uint64_t v_ )
+{
+    std::size_t k = v_ == 0 ? 0 : 64 - static_cast< std::size_t >( __builtin_clzll( v_ ) );
+    if ( k >= N_BUCKETS )
+        k = N_BUCKETS - 1;
+    bump( buckets[k] );
+    bump( count );
+    bump( sum, v_ );
+}
+
+//<! Registra o resultado do parsing de uma linha
+void stats::Counters::parsed( Tokenizer::Result::code_t code_, std::size_t n_tokens_ )
+{
+    bump( lines );
+    bump( tokenizer[ code_ ] );
+    if ( code_ == Tokenizer::Result::OK and n_tokens_ > 0 )
+        tokens.record( n_tokens_ );
+}
+
+//<! Registra o resultado do cálculo de uma expressão
+void stats::Counters::evaluated( Bares::Result::code_t code_ )
+{
+    bump( bares[ code_ ] );
+}
+
+//<! Registra um resultado vindo do cache
+void stats::Counters::cached( Bares::Result::code_t code_ )
+{
+    bump( cache_hits );
+    bump( bares[ code_ ] );
+}
+
+//<! Registra a duração de um estágio
+stats::clock_type::time_point stats::Counters::lap( stage_t stage_, clock_type::time_point start_ )
+{
+    auto now = clock_type::now();
+    latency[ stage_ ].record( static_cast< std::uint64_t >(
+        std::chrono::duration_cast< std::chrono::nanoseconds >( now - start_ ).count() ) );
+    return now;
+}
+
+//<! Limite superior do balde que contém o quantil
+std::uint64_t stats::Snapshot::Hist::quantile( double q_ ) const
+{
+    if ( count == 0 )
+        return 0;
+
+    std::uint64_t rank = static_cast< std::uint64_t >( q_ * double( count - 1 ) ) + 1;
+    std::uint64_t seen = 0;
+    for ( std::size_t k = 0; k < N_BUCKETS; ++k )
+    {
+        seen += buckets[k];
+        if ( seen >= rank )
+            return bucket_bound( k );
+    }
+    return bucket_bound( N_BUCKETS - 1 );
+}
+
+//<! Acrescenta os contadores de uma thread
+void stats::Snapshot::add( const Counters & c_ )
+{
+    lines += c_.lines.load( std::memory_order_relaxed );
+    for ( std::size_t i = 0; i < N_TOKENIZER_CODES; ++i )
+        tokenizer[i] += c_.tokenizer[i].load( std::memory_order_relaxed );
+    for ( std::size_t i = 0; i < N_BARES_CODES; ++i )
+        bares[i] += c_.bares[i].load( std::memory_order_relaxed );
+    cache_hits += c_.cache_hits.load( std::memory_order_relaxed );
+    add_hist( tokens, c_.tokens );
+    for ( std::size_t s = 0; s < N_STAGES; ++s )
+        add_hist( latency[s], c_.latency[s] );
+}
+
+//<! Escreve em JSON
+void stats::Snapshot::write_json( std::ostream & os_ ) const
+{
+    os_ << "{\"lines\":" << lines << ",\"tokenizer\":{";
+    for ( std::size_t i = 0; i < N_TOKENIZER_CODES; ++i )
+        os_ << ( i ? "," : "" ) << '"' << tokenizer_names[i] << "\":" << tokenizer[i];
+    os_ << "},\"bares\":{";
+    for ( std::size_t i = 0; i < N_BARES_CODES; ++i )
+        os_ << ( i ? "," : "" ) << '"' << bares_names[i] << "\":" << bares[i];
+    os_ << "},\"cache_hits\":" << cache_hits << ",\"tokens_per_expression\":";
+    hist_json( os_, tokens );
+    os_ << ",\"latency_ns\":{";
+    for ( std::size_t s = 0; s < N_STAGES; ++s )
+    {
+        os_ << ( s ? "," : "" ) << '"' << stage_names[s] << "\":";
+        hist_json( os_, latency[s] );
+    }
+    os_ << "}}\n";
+}
+
+//<! Escreve no formato texto do Prometheus
+void stats::Snapshot::write_prom( std::ostream & os_ ) const
+{
+    os_ << "# HELP bares_lines_total Linhas processadas.\n"
+        << "# TYPE bares_lines_total counter\n"
+        << "bares_lines_total " << lines << '\n';
+
+    os_ << "# HELP bares_tokenizer_results_total Resultados do parsing por código.\n"
+        << "# TYPE bares_tokenizer_results_total counter\n";
+    for ( std::size_t i = 0; i < N_TOKENIZER_CODES; ++i )
+        os_ << "bares_tokenizer_results_total{code=\"" << tokenizer_names[i] << "\"} " << tokenizer[i] << '\n';
+
+    os_ << "# HELP bares_evaluation_results_total Resultados do cálculo por código.\n"
+        << "# TYPE bares_evaluation_results_total counter\n";
+    for ( std::size_t i = 0; i < N_BARES_CODES; ++i )
+        os_ << "bares_evaluation_results_total{code=\"" << bares_names[i] << "\"} " << bares[i] << '\n';
+
+    os_ << "# HELP bares_cache_hits_total Acertos do cache de resultados.\n"
+        << "# TYPE bares_cache_hits_total counter\n"
+        << "bares_cache_hits_total " << cache_hits << '\n';
+
+    os_ << "# HELP bares_tokens_per_expression Tokens por expressão válida.\n"
+        << "# TYPE bares_tokens_per_expression histogram\n";
+    hist_prom( os_, "bares_tokens_per_expression", "", tokens, 1.0 );
+
+    os_ << "# HELP bares_stage_latency_seconds Latência de cada estágio por linha.\n"
+        << "# TYPE bares_stage_latency_seconds histogram\n";
+    for ( std::size_t s = 0; s < N_STAGES; ++s )
+        hist_prom( os_, "bares_stage_latency_seconds", std::string( "stage=\"" ) + stage_names[s] + "\"",
+                   latency[s], 1e-9 );
+}
+
+//<! Cria um bloco de contadores para uma thread
+stats::Counters * stats::Registry::add( void )
+{
+    std::lock_guard< std::mutex > lk( m );
+    blocks.emplace_back( new Counters );
+    return blocks.back().get();
+}
+
+//<! Soma os contadores de todas as threads
+stats::Snapshot stats::Registry::snapshot( void )
+{
+    std::lock_guard< std::mutex > lk( m );
+    Snapshot s;
+    for ( const auto & b : blocks )
+        s.add( *b );
+    return s;
+}
+
+//<! Escreve o relatório no formato pedido
+void stats::Registry::write( std::ostream & os_, format_t format_ )
+{
+    Snapshot s = snapshot();
+    if ( format_ == format_t::JSON )
+        s.write_json( os_ );
+    else
+        s.write_prom( os_ );
+}
+
+//<! Grava o relatório em arquivo ou em stderr
+bool stats::dump( Registry & registry_, format_t format_, const std::string & path_ )
+{
+    if ( path_.empty() )
+    {
+        registry_.write( std::cerr, format_ );
+        return bool( std::cerr );
+    }
+
+    //Quem lê o arquivo nunca vê um relatório pela metade
+    const std::string tmp = path_ + ".tmp";
+    {
+        std::ofstream out( tmp );
+        registry_.write( out, format_ );
+        if ( not out )
+            return false;
+    }
+    return std::rename( tmp.c_str(), path_.c_str() ) == 0;
+}
+
+//<! Inicia a thread de relatório
+stats::Reporter::Reporter( Registry & registry_, format_t format_, std::string path_, unsigned seconds_ )
+    : registry( registry_ )
+    , format( format_ )
+    , path( std::move( path_ ) )
+    , seconds( seconds_ == 0 ? 1 : seconds_ )
+    , stop( false )
+{
+    worker = std::thread( [this]{
+        std::unique_lock< std::mutex > lk( m );
+        while ( not cv.wait_for( lk, std::chrono::seconds( seconds ), [this]{ return stop; } ) )
+            dump( registry, format, path );
+    } );
+}
+
+//<! Para a thread
+stats::Reporter::~Reporter()
+{
+    {
+        std::lock_guard< std::mutex > lk( m );
+        stop = true;
+    }
+    cv.notify_all();
+    worker.join();
+}
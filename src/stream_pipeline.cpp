@@ -0,0 +1,162 @@
+/**
+ * @file stream_pipeline.cpp
+ * @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+ * @date 18 Outubro 2026
+ * @brief Arquivo com a implementação do modo de avaliação em fluxo.
+ */
+
+#include "stream_pipeline.h"
+
+#include <cerrno>   // errno
+#include <thread>   // std::thread
+#include <unistd.h> // read
+
+
+//<! Cria o pipeline
+StreamPipeline::StreamPipeline( int in_fd_, std::ostream & out_, const EvalOptions & options_ )
+    : in_fd( in_fd_ )
+    , out( out_ )
+    , read_ok( true )
+    , options( options_ )
+    , chunks( QUEUE_CAP )
+    , lines( QUEUE_CAP )
+    , parsed( QUEUE_CAP )
+    , outputs( QUEUE_CAP )
+{ /* empty */ }
+
+//<! Executa o pipeline até o fim da entrada
+bool StreamPipeline::run( void )
+{
+    std::thread reader( &StreamPipeline::read_stage, this );
+    std::thread splitter( &StreamPipeline::split_stage, this );
+    std::thread parser( &StreamPipeline::parse_stage, this );
+    std::thread evaluator( &StreamPipeline::eval_stage, this );
+
+    write_stage();
+
+    reader.join();
+    splitter.join();
+    parser.join();
+    evaluator.join();
+
+    return read_ok and bool( out );
+}
+
+//<! Lê blocos da entrada assim que estiverem disponíveis
+void StreamPipeline::read_stage( void )
+{
+    while ( true )
+    {
+        std::string chunk( READ_SIZE, '\0' );
+        ssize_t n = ::read( in_fd, &chunk[0], chunk.size() );
+        if ( n < 0 and errno == EINTR )
+            continue;
+        if ( n <= 0 )
+        {
+            read_ok = ( n == 0 );
+            break;
+        }
+
+        chunk.resize( static_cast< std::size_t >( n ) );
+        if ( not chunks.push( std::move( chunk ) ) )
+            break;
+    }
+    chunks.close();
+}
+
+//<! Separa os blocos em linhas
+void StreamPipeline::split_stage( void )
+{
+    std::string carry; // Linha incompleta do bloco anterior.
+    std::string chunk;
+
+    while ( chunks.pop( chunk ) )
+    {
+        line_batch batch;
+        std::size_t begin = 0;
+        for ( std::size_t nl = chunk.find( '\n' ); nl != std::string::npos; nl = chunk.find( '\n', begin ) )
+        {
+            carry.append( chunk, begin, nl - begin );
+            batch.push_back( std::move( carry ) );
+            carry.clear();
+            begin = nl + 1;
+
+            if ( batch.size() == BATCH_LINES )
+            {
+                lines.push( std::move( batch ) );
+                batch.clear();
+            }
+        }
+        carry.append( chunk, begin, std::string::npos );
+
+        //Entrega o lote parcial para que os resultados não esperem o próximo bloco
+        if ( not batch.empty() )
+            lines.push( std::move( batch ) );
+    }
+
+    //Última linha sem '\n'
+    if ( not carry.empty() )
+        lines.push( line_batch{ std::move( carry ) } );
+
+    lines.close();
+}
+
+//<! Faz o parsing de cada linha
+void StreamPipeline::parse_stage( void )
+{
+    Tokenizer my_parser;
+    line_batch batch;
+    stats::Counters * counters = options.stats ? options.stats->add() : nullptr;
+
+    while ( lines.pop( batch ) )
+    {
+        parsed_batch out_batch( batch.size() );
+        for ( std::size_t i = 0; i < batch.size(); ++i )
+        {
+            auto t = counters ? stats::clock_type::now() : stats::clock_type::time_point();
+            out_batch[i].result = my_parser.parse( batch[i] );
+            if ( counters )
+            {
+                counters->lap( stats::TOKENIZE, t );
+                counters->parsed( out_batch[i].result.type, my_parser.get_tokens().size() );
+            }
+            if ( out_batch[i].result.type == Tokenizer::Result::OK )
+                out_batch[i].tokens = my_parser.get_tokens();
+        }
+        parsed.push( std::move( out_batch ) );
+    }
+    parsed.close();
+}
+
+//<! Avalia as linhas válidas e formata a saída de cada lote
+void StreamPipeline::eval_stage( void )
+{
+    Evaluator evaluator( options );
+    OutputWriter out( options.output );
+    parsed_batch batch;
+
+    while ( parsed.pop( batch ) )
+    {
+        for ( const auto & line : batch )
+        {
+            if ( line.result.type != Tokenizer::Result::OK )
+                out.parse_error( line.result );
+            else
+                evaluator.eval_tokens( line.tokens, out );
+        }
+        outputs.push( std::string( out.view() ) );
+        out.clear();
+    }
+    outputs.close();
+}
+
+//<! Escreve a saída de cada lote assim que ela fica pronta
+void StreamPipeline::write_stage( void )
+{
+    std::string block;
+    while ( outputs.pop( block ) )
+    {
+        out.write( block.data(), block.size() );
+        out.flush();
+    }
+}
@@ -7,73 +7,79 @@
 
 #include "../include/tokenizer.h"
 
+namespace {
+    //<! Monta a tabela caractere -> terminal symbol usada pelo lexer.
+    template < typename TS >
+    struct LexTable
+    {
+        TS table[256];
+
+        constexpr LexTable() : table()
+        {
+            for ( int c = 0; c < 256; ++c ) table[c] = TS::TS_INVALID;
+            table[ (unsigned char)'+' ] = TS::TS_PLUS;
+            table[ (unsigned char)'-' ] = TS::TS_MINUS;
+            table[ (unsigned char)'%' ] = TS::TS_MOD;
+            table[ (unsigned char)'/' ] = TS::TS_SLASH;
+            table[ (unsigned char)'*' ] = TS::TS_ASTERISK;
+            table[ (unsigned char)'^' ] = TS::TS_CARRET;
+            table[ (unsigned char)')' ] = TS::TS_CLOSING_SCOPE;
+            table[ (unsigned char)'(' ] = TS::TS_OPENING_SCOPE;
+            table[ (unsigned char)' ' ] = TS::TS_WS;
+            table[ 9 ]                  = TS::TS_TAB;
+            table[ (unsigned char)'0' ] = TS::TS_ZERO;
+            for ( int c = '1'; c <= '9'; ++c ) table[c] = TS::TS_NON_ZERO_DIGIT;
+            for ( int c = 'a'; c <= 'z'; ++c ) table[c] = TS::TS_LETTER;
+            for ( int c = 'A'; c <= 'Z'; ++c ) table[c] = TS::TS_LETTER;
+            table[ (unsigned char)'_' ] = TS::TS_LETTER;
+            table[ 0 ]                  = TS::TS_EOS; // end of string: the $ terminal symbol
+        }
+    };
+}
+
 /// Converte um caractere válido para seu correspondente  em terminal symbol.
-Tokenizer::terminal_symbol_t  Tokenizer::lexer( char c_ ) const
+template < typename Int >
+typename BasicTokenizer< Int >::terminal_symbol_t  BasicTokenizer< Int >::lexer( char c_ ) const
 {
-    switch( c_ )
-    {
-        case '+':  return terminal_symbol_t::TS_PLUS;
-        case '-':  return terminal_symbol_t::TS_MINUS;
-        case '%':  return terminal_symbol_t::TS_MOD;
-        case '/':  return terminal_symbol_t::TS_SLASH;
-        case '*':  return terminal_symbol_t::TS_ASTERISK;
-        case '^':  return terminal_symbol_t::TS_CARRET;
-        case ')':  return terminal_symbol_t::TS_CLOSING_SCOPE;
-        case '(':  return terminal_symbol_t::TS_OPENING_SCOPE;
-        case ' ':  return terminal_symbol_t::TS_WS;
-        case   9:  return terminal_symbol_t::TS_TAB;
-        case '0':  return terminal_symbol_t::TS_ZERO;
-        case '1':
-        case '2':
-        case '3':
-        case '4':
-        case '5':
-        case '6':
-        case '7':
-        case '8':
-        case '9':  return terminal_symbol_t::TS_NON_ZERO_DIGIT;
-        case '\0': return terminal_symbol_t::TS_EOS; // end of string: the $ terminal symbol
-    }
-    return terminal_symbol_t::TS_INVALID;
+    static constexpr LexTable< terminal_symbol_t > lex{};
+    return lex.table[ static_cast< unsigned char >( c_ ) ];
 }
 
 
-/// Converte um terminal symbol para seu correspondente em string.
-std::string Tokenizer::token_str( terminal_symbol_t s_ ) const
+/// Converte um terminal symbol de operador para seu correspondente em TokenKinds::operator_t.
+template < typename Int >
+TokenKinds::operator_t BasicTokenizer< Int >::operator_of( terminal_symbol_t s_ ) const
 {
     switch( s_ )
     {
-        case terminal_symbol_t::TS_PLUS      : return "+";
-        case terminal_symbol_t::TS_MINUS     : return "-";
-        case terminal_symbol_t::TS_MOD       : return "%";
-        case terminal_symbol_t::TS_SLASH     : return "/";
-        case terminal_symbol_t::TS_ASTERISK  : return "*";
-        case terminal_symbol_t::TS_CARRET    : return "^";
-        case terminal_symbol_t::TS_CLOSING_SCOPE 
-                                             : return ")";
-        case terminal_symbol_t::TS_OPENING_SCOPE 
-                                             : return "(";
-        case terminal_symbol_t::TS_WS        : return " ";
-        case terminal_symbol_t::TS_ZERO      : return "0";
-        default                              : return "X";
+        case terminal_symbol_t::TS_PLUS      : return TokenKinds::operator_t::PLUS;
+        case terminal_symbol_t::TS_MINUS     : return TokenKinds::operator_t::MINUS;
+        case terminal_symbol_t::TS_MOD       : return TokenKinds::operator_t::MOD;
+        case terminal_symbol_t::TS_SLASH     : return TokenKinds::operator_t::SLASH;
+        case terminal_symbol_t::TS_ASTERISK  : return TokenKinds::operator_t::ASTERISK;
+        case terminal_symbol_t::TS_CARRET    : return TokenKinds::operator_t::CARRET;
+        default                              : return TokenKinds::operator_t::NONE;
     }
 }
 
 //<! Consome um caractere válido para a expressão a ser parsed.
-void Tokenizer::next_symbol( void )
+template < typename Int >
+void BasicTokenizer< Int >::next_symbol( void )
 {
     //<! Pega um símbolo válido para processar
     std::advance( it_curr_symb, 1 );
 }
 
 //<! Verifica se o caractere atual é igual ao simbolo solicitado
-bool Tokenizer::peek( terminal_symbol_t c_ ) const
+template < typename Int >
+bool BasicTokenizer< Int >::peek( terminal_symbol_t c_ ) const
 {
     return ( not end_input() ) and lexer( *it_curr_symb ) == c_;
 }
 
 //<!  Tenta aceitar o símbolo solicitado
-bool Tokenizer::accept( terminal_symbol_t c_ )
+template < typename Int >
+bool BasicTokenizer< Int >::accept( terminal_symbol_t c_ )
 {
     if ( peek(c_))
     {
@@ -86,52 +92,48 @@ bool Tokenizer::accept( terminal_symbol_t c_ )
 
 //<! Ignora qualquer espaço/Tab e tenta aceitar o símbolo solicitado.
 // !  se for aceito, avança para o próximo caractere
-bool Tokenizer::expect( terminal_symbol_t c_ )
+template < typename Int >
+bool BasicTokenizer< Int >::expect( terminal_symbol_t c_ )
 {
     skip_ws();
     return accept(c_); // Stub
 }
 
 //<! Ignora qualquer espaço/Tab e para no próximo caractere
-void Tokenizer::skip_ws( void )
+template < typename Int >
+void BasicTokenizer< Int >::skip_ws( void )
 {
-    //<! Avança enquanto houver espaço ou tab
-    while ( (not end_input()) and 
-            ((lexer( *it_curr_symb ) == Tokenizer::terminal_symbol_t::TS_WS) or
-             (lexer( *it_curr_symb ) == Tokenizer::terminal_symbol_t::TS_TAB )) )
-    {
-        next_symbol();
-    }
+    //<! Salta toda a sequência de espaços/tabs de uma vez, pela máscara
+    it_curr_symb = expr.begin() + masks.next_non_ws( position() );
 }
 
 //<! Verifica se chegamos ao final da seqüência de expressão
-bool Tokenizer::end_input( void ) const
+template < typename Int >
+bool BasicTokenizer< Int >::end_input( void ) const
 {
     return it_curr_symb == expr.end(); // Stub
 }
 
-/// Converte de String para inteiro
-Tokenizer::input_int_type str_to_int( std::string input_str_ )
+//<! Posição (a partir de 0) do caractere atual
+template < typename Int >
+std::size_t BasicTokenizer< Int >::position( void ) const
 {
-    // Creaando uma string de entrada
-    std::istringstream iss( input_str_ );
-
-    // Valor resultante.
-    Tokenizer::input_int_type value;
-    iss >> value; // Ignore os espaços em branco
-
-    // Check erro durante a converção
-    if ( iss.fail() )
-        throw std::runtime_error( "str_to_int(): Erro, illegal integer format." );
+    return static_cast< std::size_t >( std::distance( expr.begin(), it_curr_symb ) );
+}
 
-    return value;
+//<! Coluna (a partir de 1) do caractere atual
+template < typename Int >
+std::uint32_t BasicTokenizer< Int >::column( void ) const
+{
+    return static_cast< std::uint32_t >( position() + 1 );
 }
 
 //=== NTS methods.
 
 //<! <expr> := <term>,{ ("+"|"-"|"*"|"/"|"%"|"^"),<term> }
 //<! Resolve a expressão
-Tokenizer::Result Tokenizer::expression()
+template < typename Int >
+ParseResult BasicTokenizer< Int >::expression()
 {
     //ignora espaço em branco
     skip_ws();
@@ -140,52 +142,19 @@ Tokenizer::Result Tokenizer::expression()
     //resultado ok, pode vir +/- <term>
     while ( result.type == Result::OK)
     {
-
-        //pode vir o '+'
-        if (expect(terminal_symbol_t::TS_PLUS))
-        {
-            // Token "+", Operator
-            token_list.push_back( 
-                Token(token_str(terminal_symbol_t::TS_PLUS), Token::token_t::OPERATOR));
-
-        }
-        else if ( expect(terminal_symbol_t::TS_MINUS))
-        {
-            // Token "-", Operator
-            token_list.push_back( 
-                Token(token_str(terminal_symbol_t::TS_MINUS), Token::token_t::OPERATOR));   
-        }
-        else if ( expect(terminal_symbol_t::TS_ASTERISK))
-        {
-            // Token "*", Operator
-            token_list.push_back( 
-                Token(token_str(terminal_symbol_t::TS_ASTERISK), Token::token_t::OPERATOR));
-        }
-        else if ( expect(terminal_symbol_t::TS_SLASH))
-        {
-            // Token "/", Operator
-            token_list.push_back( 
-                Token(token_str(terminal_symbol_t::TS_SLASH), Token::token_t::OPERATOR));
-        }
-         else if ( expect(terminal_symbol_t::TS_MOD))
-        {
-            // Token "%", Operator
-            token_list.push_back( 
-                Token(token_str(terminal_symbol_t::TS_MOD), Token::token_t::OPERATOR));
-        }
-        else if ( expect(terminal_symbol_t::TS_CARRET))
-        {
-            // Token "^", Operator
-            token_list.push_back( 
-                Token(token_str(terminal_symbol_t::TS_CARRET), Token::token_t::OPERATOR));
-        }
-        else 
-        {
+        //pode vir um dos operadores
+        skip_ws();
+        if ( not masks.is_operator( position() ) )
             return result;
-        }
+        auto op = operator_of( lexer( *it_curr_symb ) );
+
+        // Token do operador, com a coluna onde ele aparece
+        token_list.push_back( token_type( TokenKinds::token_t::OPERATOR, op, 0, column() ) );
+        next_symbol();
 
         result = term();
-        if ( result.type != Result::OK and result.type != Result::INTEGER_OUT_OF_RANGE and end_input())
+        if ( result.type != Result::OK and result.type != Result::INTEGER_OUT_OF_RANGE
+             and result.type != Result::TOO_MANY_VARIABLES and end_input())
         {
             result.type = Result::MISSING_TERM;
             return result;
@@ -195,18 +164,19 @@ Tokenizer::Result Tokenizer::expression()
     return result;
 }
 
-//<! <term> := "(",<expr>,")" | <integer>
+//<! <term> := "(",<expr>,")" | <integer> | {"-"},<variable>
 //<! Verifica se é termo
-Tokenizer::Result Tokenizer::term()
+template < typename Int >
+ParseResult BasicTokenizer< Int >::term()
 {
     skip_ws();
-    std::string::iterator it_begin =  it_curr_symb;
+    std::string_view::const_iterator it_begin =  it_curr_symb;
 
     Result result = Result( Result::MISSING_TERM, std::distance( expr.begin(), it_curr_symb) +1 );
     //Pode vir um "("
     if( expect(terminal_symbol_t::TS_OPENING_SCOPE)){
         token_list.push_back( 
-                           Token( token_str(terminal_symbol_t::TS_OPENING_SCOPE), Token::token_t::OPENING_SCOPE));
+                           token_type( TokenKinds::token_t::OPENING_SCOPE, TokenKinds::operator_t::NONE, 0, result.at_col ));
         result = expression();
         
         //Se não houver erro na expressão, deve vir ")"
@@ -216,23 +186,23 @@ Tokenizer::Result Tokenizer::term()
             
             //Se for ")", adiciona à lista de tokens
             token_list.push_back( 
-                           Token( token_str(terminal_symbol_t::TS_CLOSING_SCOPE), Token::token_t::CLOSING_SCOPE));
+                           token_type( TokenKinds::token_t::CLOSING_SCOPE, TokenKinds::operator_t::NONE, 0, column() - 1 ));
         }
+    } else if ( with_variables and starts_variable() ){
+        result = variable();
     } else{
-        result =  integer();
+        input_int_type value = 0;
+        bool negative = false;
+        result =  integer( value, negative );
 
         if( result.type == Result::OK ){
-            //Salva número recuperado com string
-            std::string num;
-            num.insert(num.begin(), it_begin+result.at_col, it_curr_symb);
-
-            //Testa se num está no limite de required_int_type
-            input_int_type value = std::stoll(num);
-            if( value <= std::numeric_limits< Tokenizer::required_int_type >::max() 
-                and value >= std::numeric_limits< Tokenizer::required_int_type >::min()){
+            //Testa se o valor está no limite de required_int_type
+            required_int_type v;
+            if( not arith::from_magnitude( value, negative, v ) ){
 
                 token_list.push_back( 
-                           Token( num, Token::token_t::OPERAND));
+                           token_type( TokenKinds::token_t::OPERAND, TokenKinds::operator_t::NONE, v,
+                                       std::distance( expr.begin(), it_begin) + 1 ));
                 
             } else{
                 result.type = Result::INTEGER_OUT_OF_RANGE;
@@ -244,12 +214,70 @@ Tokenizer::Result Tokenizer::term()
     return result;
 }
 
+//<! Verifica se o termo que começa aqui é uma variável
+template < typename Int >
+bool BasicTokenizer< Int >::starts_variable( void ) const
+{
+    std::size_t pos = position();
+    while ( pos < expr.size() and lexer( expr[ pos ] ) == terminal_symbol_t::TS_MINUS )
+        pos = masks.next_non_ws( pos + 1 );
+    return pos < expr.size() and lexer( expr[ pos ] ) == terminal_symbol_t::TS_LETTER;
+}
+
+//<! {"-"},<variable> com <variable> := <letter>,{ <letter> | <digit> }
+//<! Lê uma variável
+template < typename Int >
+ParseResult BasicTokenizer< Int >::variable()
+{
+    const std::uint32_t col = column();
+
+    //Como nas constantes, um número ímpar de "-" nega o valor
+    auto cont(0);
+    while( expect(terminal_symbol_t::TS_MINUS) ){
+        cont++;
+    }
+    skip_ws();
+
+    auto it_name = it_curr_symb;
+    while ( not end_input() )
+    {
+        auto s = lexer( *it_curr_symb );
+        if ( s != terminal_symbol_t::TS_LETTER and s != terminal_symbol_t::TS_ZERO
+             and s != terminal_symbol_t::TS_NON_ZERO_DIGIT )
+            break;
+        next_symbol();
+    }
+    std::string_view name( &*it_name, static_cast< std::size_t >( it_curr_symb - it_name ) );
+
+    //O índice do nome (os nomes novos vão para o fim da lista)
+    std::size_t index = 0;
+    while ( index < names.size() and names[ index ] != name )
+        ++index;
+    if ( index == names.size() )
+    {
+        //O índice precisa caber no valor do Token
+        if ( index >= MAX_VARIABLES )
+            return Result( Result::TOO_MANY_VARIABLES, std::distance( expr.begin(), it_name ) + 1 );
+        names.emplace_back( name );
+    }
+
+    token_list.push_back(
+        token_type( TokenKinds::token_t::VARIABLE,
+                    cont % 2 == 1 ? TokenKinds::operator_t::MINUS : TokenKinds::operator_t::NONE,
+                    static_cast< required_int_type >( index ), col ));
+
+    return Result( Result::OK );
+}
+
 //<! <integer> := 0 | ["-"],<natural_number>;
 //<! Verifica se é inteiro
-Tokenizer::Result Tokenizer::integer()
+template < typename Int >
+ParseResult BasicTokenizer< Int >::integer( input_int_type & value_, bool & negative_ )
 {
+    negative_ = false;
     if ( accept(terminal_symbol_t::TS_ZERO) )
     {
+        value_ = 0;
         return Result( Result::OK );
     }
     
@@ -258,18 +286,12 @@ Tokenizer::Result Tokenizer::integer()
     while( expect(terminal_symbol_t::TS_MINUS) ){
         cont++;
     }
-    //Se o número de "-" for par, o número será positivo
-    //Ou seja, todos os "-" serão ignorados
-    //Se for ímpar, o número será negativo
-    //Ou seja, apenas o último "-" vai ser considerado
-    if(cont % 2 == 1)
-        cont-=1;
 
-    auto result =  natural_number();
+    auto result =  natural_number( value_ );
 
-    // Se o resultado for ok, conta quantos "-" vai ter que ignorar
-    if(result.type == Result::OK)
-        result.at_col = cont;
+    //Se o número de "-" for par, o número será positivo
+    //Se for ímpar, o número será negativo
+    negative_ = cont % 2 == 1;
 
     return result; 
 
@@ -277,14 +299,24 @@ Tokenizer::Result Tokenizer::integer()
 
 //<natural_number> := <digit_excl_zero>,{<digit>}
 //<! Verifica se é número natural
-Tokenizer::Result Tokenizer::natural_number()
+template < typename Int >
+ParseResult BasicTokenizer< Int >::natural_number( input_int_type & value_ )
 {
-    auto result = digit_excl_zero();
-    if( result) {
-    
-        while( result){
-            result = digit();
-        }
+    auto it_digits = it_curr_symb;
+    if( digit_excl_zero() ) {
+        //<! {<digit>}: a sequência de dígitos termina no primeiro bit zerado da máscara
+        it_curr_symb = expr.begin() + masks.next_non_digit( position() );
+
+        //Ao estourar, a constante já está fora da faixa de Int: o módulo
+        //fica saturado e os dígitos restantes são ignorados.
+        value_ = 0;
+        for ( ; it_digits != it_curr_symb; ++it_digits )
+            if ( arith::mul( value_, input_int_type( 10 ), value_ )
+                 or arith::add( value_, input_int_type( *it_digits - '0' ), value_ ) )
+            {
+                value_ = std::numeric_limits< input_int_type >::max();
+                break;
+            }
 
         return Result( Result::OK );
     }
@@ -296,26 +328,23 @@ Tokenizer::Result Tokenizer::natural_number()
 
 //<! <digit_excl_zero> := "1"|"2"|"3"|"4"|"5"|"6"|"7"|"8"|"9"
 //<! Verifica se é dígito exceto zero
-bool Tokenizer::digit_excl_zero()
+template < typename Int >
+bool BasicTokenizer< Int >::digit_excl_zero()
 {  
     return accept( terminal_symbol_t::TS_NON_ZERO_DIGIT );
 }
 
-//<! <digit> := "0" | <digit_excl_zero>
-//<! Verifica se é dígito
-bool Tokenizer::digit()
-{ 
-    return (accept( terminal_symbol_t::TS_ZERO ) or digit_excl_zero() );
-}
-
 //<! Recebe uma expressão, realiza o parsing e retorna o resultado.
-Tokenizer::Result
-Tokenizer::parse( std::string e_ )
+template < typename Int >
+ParseResult
+BasicTokenizer< Int >::parse( std::string_view e_ )
 {
     // Por padrão, o processo é reiniciado.
-    expr = e_;  // String com expressão.
+    expr = e_;  // Visão da expressão (sem cópia).
     it_curr_symb = expr.begin(); // Iterador para o primeiro caratere da expressão.
+    masks.classify( expr ); // Classifica todos os caracteres de uma vez.
     token_list.clear(); // Limpa a lista de tokens.
+    names.clear(); // E a lista de variáveis.
 
     // Resultado padrão.
     Result result( Result::OK );
@@ -345,12 +374,19 @@ Tokenizer::parse( std::string e_ )
 }
 
 //<! Recupera a lista de Tokens
-std::vector< Token >
-Tokenizer::get_tokens( void ) const
+template < typename Int >
+const std::vector< typename BasicTokenizer< Int >::token_type > &
+BasicTokenizer< Int >::get_tokens( void ) const
 {
     return token_list;
 }
 
 
 
+//<! Larguras suportadas
+template class BasicTokenizer< std::int16_t >;
+template class BasicTokenizer< std::int32_t >;
+template class BasicTokenizer< std::int64_t >;
+template class BasicTokenizer< __int128 >;
+
 //==========================[ Fim do parse.cpp ]==========================//
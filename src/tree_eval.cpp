@@ -0,0 +1,264 @@
+/**
+ * @file tree_eval.cpp
+ * @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+ * @date 18 Outubro 2026
+ * @brief Arquivo com a implementação da classe TreeEvaluator.
+ */
+
+#include "tree_eval.h"
+
+#include <algorithm> // std::min, std::max, std::clamp
+#include <cassert>   // assert
+
+namespace {
+
+    using op_t = Token::operator_t;
+
+    //<! Subárvores com menos Tokens que isto são avaliadas por uma única thread.
+    constexpr std::uint32_t GRAIN = 4096;
+
+    //<! Níveis de paralelismo aninhado; abaixo disso a avaliação é sequencial.
+    constexpr std::size_t MAX_DEPTH = 64;
+
+    //<! Segmentos de uma cadeia por trabalhador (sobra para o roubo equilibrar).
+    constexpr std::size_t SEGMENTS_PER_WORKER = 4;
+
+    //<! Limite dos produtos parciais da primeira passada: acima de int16, mas
+    //<! pequeno o bastante para que produto * operando caiba em 64 bits.
+    constexpr std::int64_t CLAMP = std::int64_t( 1 ) << 20;
+
+    bool is_additive( op_t op_ )
+    {  return op_ == op_t::PLUS or op_ == op_t::MINUS; }
+
+    bool in_range( std::int64_t v_ )
+    {  return v_ >= -32768 and v_ <= 32767; }
+
+    //<! Um passo da cadeia em 64 bits (o mesmo que Bares::execute para + - *)
+    std::int64_t step( std::int64_t acc_, op_t op_, std::int64_t v_ )
+    {
+        switch ( op_ )
+        {
+            case op_t::PLUS     : return acc_ + v_;
+            case op_t::MINUS    : return acc_ - v_;
+            case op_t::ASTERISK : return acc_ * v_;
+            default             : return v_; // NONE: primeiro operando
+        }
+    }
+
+    //<! Operandos [first, last) de uma cadeia avaliados por uma tarefa
+    struct Segment
+    {
+        std::size_t first = 0;
+        std::size_t last = 0;
+        std::int64_t total = 0; //<! Soma ou produto (limitado a CLAMP) do segmento.
+        std::int64_t enter = 0; //<! Valor acumulado na entrada do segmento.
+        bool event = false;     //<! Há um erro no segmento (segunda passada).
+        Bares::Result result;   //<! O erro, ou o valor na saída do segmento.
+    };
+}
+
+//<! Cria o avaliador
+TreeEvaluator::TreeEvaluator( WorkStealingPool & pool_ )
+    : pool( pool_ )
+{
+    for ( std::size_t i = 0; i <= pool.size(); ++i )
+        spaces.emplace_back( new Workspace );
+}
+
+//<! Avalia uma expressão já validada pelo Tokenizer
+Bares::Result TreeEvaluator::evaluate( const std::vector< Token > & infix_ )
+{
+    converter.infix_to_postfix( infix_ );
+    postfix = converter.postfix().data();
+    const auto n = static_cast< std::uint32_t >( converter.postfix().size() );
+
+    //Uma operação começa onde começa o seu operando da esquerda, que
+    //termina logo antes do início do operando da direita
+    start.resize( n );
+    for ( std::uint32_t i = 0; i < n; ++i )
+    {
+        assert( postfix[i].type == Token::token_t::OPERAND or postfix[i].type == Token::token_t::OPERATOR );
+        start[i] = postfix[i].type == Token::token_t::OPERAND ? i : start[ start[ i - 1 ] - 1 ];
+    }
+
+    return eval( 0, n, 0 );
+}
+
+//<! Avalia uma subárvore, em paralelo se ela for grande
+Bares::Result TreeEvaluator::eval( std::uint32_t first_, std::uint32_t last_, std::size_t depth_ )
+{
+    if ( last_ - first_ < GRAIN or depth_ >= MAX_DEPTH )
+        return eval_serial( first_, last_, space() );
+
+    const op_t op = postfix[ last_ - 1 ].op;
+    const std::uint32_t middle = start[ last_ - 2 ];
+
+    //"/", "%" ou "^": os dois lados em paralelo
+    if ( not is_additive( op ) and op != op_t::ASTERISK )
+    {
+        Bares::Result left;
+        TaskGroup g( pool );
+        g.run( [&]{ left = eval( first_, middle, depth_ + 1 ); } );
+        Bares::Result right = eval( middle, last_ - 1, depth_ + 1 );
+        g.wait();
+
+        if ( left.type_b != Bares::Result::OK )
+            return left;
+        if ( right.type_b != Bares::Result::OK )
+            return right;
+        return space().bares.execute( left.value_b, right.value_b, Token( Token::token_t::OPERATOR, op ) );
+    }
+
+    //"(a + b) - c" tem a mesma posfixa que "a + b - c": a cadeia desce
+    //pelos operandos da esquerda enquanto o operador for do mesmo tipo
+    auto same = [&]( std::uint32_t end_ ){
+        const Token & t = postfix[ end_ - 1 ];
+        return t.type == Token::token_t::OPERATOR
+           and ( is_additive( op ) ? is_additive( t.op ) : t.op == op_t::ASTERISK );
+    };
+    std::size_t m = 1;
+    for ( std::uint32_t end = last_; same( end ); end = start[ end - 2 ] )
+        ++m;
+
+    std::vector< Operand > operands( m );
+    std::uint32_t end = last_;
+    for ( std::size_t i = m - 1; i > 0; --i )
+    {
+        operands[i] = Operand{ start[ end - 2 ], end - 1, postfix[ end - 1 ].op };
+        end = start[ end - 2 ];
+    }
+    operands[0] = Operand{ first_, end, op_t::NONE };
+
+    return eval_chain( operands, depth_ );
+}
+
+//<! Avalia uma cadeia longa, por segmentos em paralelo
+Bares::Result TreeEvaluator::eval_chain( const std::vector< Operand > & operands_, std::size_t depth_ )
+{
+    const std::size_t m = operands_.size();
+    const bool additive = is_additive( operands_[1].link );
+    std::vector< Bares::Result > results( m );
+
+    //Segmentos com números de Tokens parecidos
+    const std::size_t n_segments = std::min( m, SEGMENTS_PER_WORKER * pool.size() );
+    const std::size_t target = std::max< std::size_t >( 1, ( operands_.back().last - operands_[0].first ) / n_segments );
+    std::vector< Segment > segments;
+    {
+        std::size_t first = 0, weight = 0;
+        for ( std::size_t i = 0; i < m; ++i )
+        {
+            weight += operands_[i].last - operands_[i].first;
+            if ( weight >= target or i + 1 == m )
+            {
+                segments.emplace_back();
+                segments.back().first = first;
+                segments.back().last = i + 1;
+                first = i + 1;
+                weight = 0;
+            }
+        }
+    }
+
+    auto for_each_segment = [&]( auto && f_ ){
+        TaskGroup g( pool );
+        for ( std::size_t s = 1; s < segments.size(); ++s )
+            g.run( [&f_, &segments, s]{ f_( segments[s] ); } );
+        f_( segments[0] );
+        g.wait();
+    };
+
+    //1ª passada: avalia os operandos e soma (ou multiplica) cada segmento
+    for_each_segment( [&]( Segment & seg_ ){
+        Workspace & ws = space();
+        std::int64_t total = additive ? 0 : 1;
+        for ( std::size_t i = seg_.first; i < seg_.last; ++i )
+        {
+            const Operand & o = operands_[i];
+            if ( o.last - o.first == 1 )
+                results[i] = Bares::Result( postfix[ o.first ].value );
+            else if ( o.last - o.first < GRAIN )
+                results[i] = eval_serial( o.first, o.last, ws );
+            else
+                results[i] = eval( o.first, o.last, depth_ + 1 );
+
+            if ( results[i].type_b != Bares::Result::OK )
+                continue; //O segmento terá um evento; os seguintes não importam
+            if ( additive )
+                total += o.link == op_t::MINUS ? -results[i].value_b : results[i].value_b;
+            else
+                total = std::clamp( total * results[i].value_b, -CLAMP, CLAMP );
+        }
+        seg_.total = total;
+    } );
+
+    //Valor acumulado na entrada de cada segmento. Só precisa ser exato
+    //enquanto nenhum segmento anterior tiver um evento: um produto que
+    //passa de int16 só volta a ele multiplicado por 0, e aí é 0 de novo.
+    std::int64_t acc = additive ? 0 : 1;
+    for ( Segment & seg : segments )
+    {
+        seg.enter = acc;
+        acc = additive ? acc + seg.total : std::clamp( acc * seg.total, -CLAMP, CLAMP );
+    }
+
+    //2ª passada: refaz cada segmento a partir do valor exato de entrada,
+    //procurando o primeiro operando com erro ou o primeiro overflow
+    for_each_segment( [&]( Segment & seg_ ){
+        std::int64_t v = seg_.enter;
+        for ( std::size_t i = seg_.first; i < seg_.last; ++i )
+        {
+            if ( results[i].type_b != Bares::Result::OK )
+            {
+                seg_.event = true;
+                seg_.result = results[i];
+                return;
+            }
+            v = step( v, operands_[i].link, results[i].value_b );
+            if ( not in_range( v ) )
+            {
+                seg_.event = true;
+                seg_.result = Bares::Result( 0, Bares::Result::NUMERIC_OVERFLOW );
+                return;
+            }
+        }
+        seg_.result = Bares::Result( v );
+    } );
+
+    //Vale o primeiro evento, como na avaliação da esquerda para a direita
+    for ( const Segment & seg : segments )
+        if ( seg.event )
+            return seg.result;
+    return segments.back().result;
+}
+
+//<! Avalia uma subárvore em uma única thread
+Bares::Result TreeEvaluator::eval_serial( std::uint32_t first_, std::uint32_t last_, Workspace & ws_ )
+{
+    std::vector< Bares::value_type > & s = ws_.values;
+    s.clear();
+
+    for ( std::uint32_t i = first_; i < last_; ++i )
+    {
+        const Token & t = postfix[i];
+        if ( t.type == Token::token_t::OPERAND )
+        {
+            s.push_back( t.value );
+            continue;
+        }
+
+        const Bares::value_type b = s.back();
+        s.pop_back();
+        Bares::Result r = ws_.bares.execute( s.back(), b, t );
+        if ( r.type_b != Bares::Result::OK )
+            return r;
+        s.back() = r.value_b;
+    }
+
+    return Bares::Result( s.back() );
+}
+
+//<! A área de trabalho da thread atual
+TreeEvaluator::Workspace & TreeEvaluator::space( void )
+{
+    return *spaces[ pool.worker_index() ];
+}
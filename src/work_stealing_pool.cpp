@@ -0,0 +1,164 @@
+/**
+ * @file work_stealing_pool.cpp
+ * @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+ * @date 18 Outubro 2026
+ * @brief Arquivo com a implementação do pool de threads com roubo de tarefas.
+ */
+
+#include "work_stealing_pool.h"
+
+namespace {
+    //<! Pool e índice do trabalhador que executa a thread atual.
+    thread_local const WorkStealingPool * tl_pool = nullptr;
+    thread_local std::size_t tl_index = 0;
+}
+
+//<! Cria o pool e inicia os trabalhadores
+WorkStealingPool::WorkStealingPool( std::size_t n_workers_ )
+    : pending( 0 )
+    , next_queue( 0 )
+    , stop( false )
+{
+    if ( n_workers_ == 0 ) n_workers_ = 1;
+
+    for ( std::size_t i = 0; i < n_workers_; ++i )
+        queues.emplace_back( new Queue );
+
+    for ( std::size_t i = 0; i < n_workers_; ++i )
+        workers.emplace_back( &WorkStealingPool::worker_loop, this, i );
+}
+
+//<! Executa as tarefas pendentes e encerra os trabalhadores
+WorkStealingPool::~WorkStealingPool()
+{
+    {
+        std::lock_guard< std::mutex > lk( sleep_m );
+        stop = true;
+    }
+    sleep_cv.notify_all();
+
+    for ( auto & w : workers )
+        w.join();
+}
+
+//<! Enfileira uma tarefa
+void WorkStealingPool::submit( task_type task_ )
+{
+    std::size_t q = worker_index();
+    if ( q == size() )
+        q = next_queue.fetch_add( 1, std::memory_order_relaxed ) % size();
+
+    //Contada antes de ficar visível: quem a retirar da fila decrementa
+    //pending, que nunca pode passar por baixo de zero
+    {
+        std::lock_guard< std::mutex > lk( sleep_m );
+        ++pending;
+    }
+
+    {
+        std::lock_guard< std::mutex > lk( queues[q]->m );
+        queues[q]->tasks.push_back( std::move( task_ ) );
+    }
+    sleep_cv.notify_one();
+}
+
+//<! Número de trabalhadores
+std::size_t WorkStealingPool::size( void ) const
+{
+    return workers.size();
+}
+
+//<! Índice do trabalhador que executa a thread atual
+std::size_t WorkStealingPool::worker_index( void ) const
+{
+    return tl_pool == this ? tl_index : size();
+}
+
+//<! Executa, na thread atual, uma tarefa pendente
+bool WorkStealingPool::run_one( void )
+{
+    task_type task;
+    if ( not try_pop( worker_index(), task ) )
+        return false;
+
+    --pending;
+    task();
+    return true;
+}
+
+//<! Tenta obter uma tarefa da própria fila ou de outra
+bool WorkStealingPool::try_pop( std::size_t id_, task_type & task_ )
+{
+    //Própria fila: pega a tarefa mais recente (threads de fora não têm fila)
+    if ( id_ < queues.size() )
+    {
+        Queue & own = *queues[id_];
+        std::lock_guard< std::mutex > lk( own.m );
+        if ( not own.tasks.empty() )
+        {
+            task_ = std::move( own.tasks.back() );
+            own.tasks.pop_back();
+            return true;
+        }
+    }
+
+    //Roubo: pega a tarefa mais antiga de outro trabalhador
+    for ( std::size_t k = 1; k <= queues.size(); ++k )
+    {
+        const std::size_t v = ( id_ + k ) % queues.size();
+        if ( v == id_ )
+            continue;
+        Queue & victim = *queues[ v ];
+        std::lock_guard< std::mutex > lk( victim.m );
+        if ( not victim.tasks.empty() )
+        {
+            task_ = std::move( victim.tasks.front() );
+            victim.tasks.pop_front();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//<! Laço principal de um trabalhador
+void WorkStealingPool::worker_loop( std::size_t id_ )
+{
+    tl_pool = this;
+    tl_index = id_;
+
+    task_type task;
+    while ( true )
+    {
+        if ( try_pop( id_, task ) )
+        {
+            --pending;
+            task();
+            task = nullptr;
+            continue;
+        }
+
+        std::unique_lock< std::mutex > lk( sleep_m );
+        sleep_cv.wait( lk, [this]{ return stop or pending > 0; } );
+        if ( stop and pending == 0 )
+            return;
+    }
+}
+
+//<! Enfileira uma tarefa do grupo
+void TaskGroup::run( WorkStealingPool::task_type task_ )
+{
+    remaining.fetch_add( 1, std::memory_order_relaxed );
+    pool.submit( [this, task = std::move( task_ )]{
+        task();
+        remaining.fetch_sub( 1, std::memory_order_release );
+    } );
+}
+
+//<! Espera todas as tarefas do grupo, ajudando o pool
+void TaskGroup::wait( void )
+{
+    while ( remaining.load( std::memory_order_acquire ) != 0 )
+        if ( not pool.run_one() )
+            std::this_thread::yield();
+}
@@ -0,0 +1,437 @@
+/**
+ * @file gen_corpus.cpp
+ * @authors Gabriel Araújo de Souza e Mayra Dantas de Azevedo
+ * @date 18 Outubro 2026
+ * @brief Gerador reprodutível de corpus de expressões, com controle do
+ *        formato e da fração de cada tipo de erro.
+ *
+ * Uso: gen_corpus [opções]
+ *   --lines N             linhas geradas (0 = sem fim)                [1000]
+ *   --seed S              semente                                     [2017]
+ *   --output ARQUIVO      saída (padrão: stdout)
+ *   --expected ARQUIVO    grava também a saída esperada do parser
+ *   --terms MIN:MAX       termos por nível de parênteses              [2:8]
+ *   --depth D             profundidade máxima de parênteses           [3]
+ *   --paren P             chance de um termo virar "( ... )"          [0.2]
+ *   --ops "+:w,-:w,..."   pesos dos operadores          [+:3,-:3,*:2,/:1,%:1,^:1]
+ *                         (sorteios que gerariam erro são refeitos, o que
+ *                         reduz a fração real de "^" e "*")
+ *   --literals MIN:MAX    faixa das constantes                        [-99:999]
+ *   --edge P              chance de uma constante ficar perto de ±32767 [0.05]
+ *   --spaces MAX          espaços/tabs entre símbolos (0 a MAX)       [1]
+ *   --error NOME=P        fração de linhas com o resultado NOME; pode repetir.
+ *                         NOME: end, ill_formed, missing_term, extraneous,
+ *                         missing_paren, out_of_range, div_zero, overflow
+ */
+
+#include <cstdio>    // std::fprintf
+#include <cstdlib>   // EXIT_SUCCESS
+#include <cstring>   // std::strcmp
+#include <fstream>   // std::ofstream
+#include <iostream>  // std::cout
+#include <limits>    // std::numeric_limits
+#include <random>    // std::mt19937
+#include <sstream>   // std::ostringstream
+#include <string>    // std::string
+#include <vector>    // std::vector
+
+#include "tokenizer.h"
+#include "bares.h"
+#include "evaluator.h"
+
+namespace {
+
+    using rng_t = std::mt19937;
+    using short_limits = std::numeric_limits< Tokenizer::required_int_type >;
+
+    /**
+     * @brief      Resultado desejado para uma linha
+     */
+    enum outcome_t
+    {
+        OK = 0,
+        END,          // Tokenizer::Result::UNEXPECTED_END_OF_EXPRESSION
+        ILL_FORMED,   // Tokenizer::Result::ILL_FORMED_INTEGER
+        MISSING_TERM, // Tokenizer::Result::MISSING_TERM
+        EXTRANEOUS,   // Tokenizer::Result::EXTRANEOUS_SYMBOL
+        MISSING_PAREN,// Tokenizer::Result::MISSING_CLOSING_PARENTHESIS
+        OUT_OF_RANGE, // Tokenizer::Result::INTEGER_OUT_OF_RANGE
+        DIV_ZERO,     // Bares::Result::DIVISION_BY_ZERO
+        NUM_OVERFLOW,     // Bares::Result::NUMERIC_OVERFLOW
+        N_OUTCOMES
+    };
+
+    //<! Nomes aceitos em --error, na ordem de outcome_t
+    const char * const outcome_names[ N_OUTCOMES ] = {
+        "ok", "end", "ill_formed", "missing_term", "extraneous",
+        "missing_paren", "out_of_range", "div_zero", "overflow"
+    };
+
+    /**
+     * @brief      Parâmetros do gerador
+     */
+    struct Config
+    {
+        std::size_t lines = 1000;
+        std::uint32_t seed = 2017;
+        std::string output;
+        std::string expected;
+        int min_terms = 2, max_terms = 8;
+        int depth = 3;
+        double paren = 0.2;
+        std::string ops = "+-*/%^";
+        std::vector< double > op_weights = { 3, 3, 2, 1, 1, 1 };
+        int min_literal = -99, max_literal = 999;
+        double edge = 0.05;
+        int spaces = 1;
+        double fraction[ N_OUTCOMES ] = {};
+    };
+
+    /**
+     * @brief      Gera expressões conforme a configuração
+     */
+    class Generator
+    {
+        public:
+            explicit Generator( const Config & cfg_ )
+                : cfg( cfg_ )
+                , rng( cfg_.seed )
+                , op_pick( cfg_.op_weights.begin(), cfg_.op_weights.end() )
+            {
+                std::vector< double > w( cfg.fraction, cfg.fraction + N_OUTCOMES );
+                double rest = 1.0;
+                for ( int k = 1; k < N_OUTCOMES; ++k )
+                    rest -= w[k];
+                w[OK] = rest > 0 ? rest : 0;
+                outcome_pick = std::discrete_distribution< int >( w.begin(), w.end() );
+            }
+
+            //<! Gera uma linha com o resultado sorteado
+            std::string line( void )
+            {
+                auto target = static_cast< outcome_t >( outcome_pick( rng ) );
+
+                //Confere com o parser de verdade e tenta de novo se não bater
+                for ( int attempt = 0; attempt < 64; ++attempt )
+                {
+                    std::string e = build( target );
+                    if ( classify( e ) == target )
+                        return e;
+                }
+                return fallback( target );
+            }
+
+            //<! Classifica a linha com o Tokenizer e o Bares
+            outcome_t classify( const std::string & e_ )
+            {
+                auto r = parser.parse( e_ );
+                switch ( r.type )
+                {
+                    case Tokenizer::Result::OK: break;
+                    case Tokenizer::Result::UNEXPECTED_END_OF_EXPRESSION: return END;
+                    case Tokenizer::Result::ILL_FORMED_INTEGER: return ILL_FORMED;
+                    case Tokenizer::Result::MISSING_TERM: return MISSING_TERM;
+                    case Tokenizer::Result::EXTRANEOUS_SYMBOL: return EXTRANEOUS;
+                    case Tokenizer::Result::MISSING_CLOSING_PARENTHESIS: return MISSING_PAREN;
+                    case Tokenizer::Result::INTEGER_OUT_OF_RANGE: return OUT_OF_RANGE;
+                    case Tokenizer::Result::TOO_MANY_VARIABLES: return EXTRANEOUS; // O gerador não usa variáveis.
+                }
+
+                switch ( bares.evaluate( parser.get_tokens() ).type_b )
+                {
+                    case Bares::Result::DIVISION_BY_ZERO: return DIV_ZERO;
+                    case Bares::Result::NUMERIC_OVERFLOW: return NUM_OVERFLOW;
+                    default: return OK;
+                }
+            }
+
+        private:
+            const Config & cfg;
+            rng_t rng;
+            std::discrete_distribution< int > op_pick;
+            std::discrete_distribution< int > outcome_pick;
+            Tokenizer parser;
+            Bares bares;
+
+            int uniform( int lo_, int hi_ )
+            {  return std::uniform_int_distribution< int >( lo_, hi_ )( rng ); }
+
+            bool chance( double p_ )
+            {  return std::uniform_real_distribution< double >( 0, 1 )( rng ) < p_; }
+
+            //<! 0 a cfg.spaces espaços/tabs
+            std::string ws( void )
+            {
+                std::string s;
+                for ( int i = uniform( 0, cfg.spaces ); i > 0; --i )
+                    s += chance( 0.75 ) ? ' ' : '\t';
+                return s;
+            }
+
+            //<! Uma constante válida
+            std::string literal( void )
+            {
+                Bares::value_type v;
+                return literal( v );
+            }
+
+            //<! Uma constante válida e o seu valor
+            std::string literal( Bares::value_type & value_ )
+            {
+                if ( chance( cfg.edge ) )
+                {
+                    //Perto dos limites de required_int_type
+                    value_ = chance( 0.5 ) ? short_limits::max() - uniform( 0, 16 )
+                                           : short_limits::min() + uniform( 0, 16 );
+                }
+                else
+                    value_ = uniform( cfg.min_literal, cfg.max_literal );
+
+                return std::to_string( value_ );
+            }
+
+            //<! Um operador conforme os pesos
+            char op( void )
+            {  return cfg.ops[ op_pick( rng ) ]; }
+
+            //<! Token do operador c_
+            static Token operator_token( char c_ )
+            {
+                switch ( c_ )
+                {
+                    case '+': return Token( Token::token_t::OPERATOR, Token::operator_t::PLUS );
+                    case '-': return Token( Token::token_t::OPERATOR, Token::operator_t::MINUS );
+                    case '*': return Token( Token::token_t::OPERATOR, Token::operator_t::ASTERISK );
+                    case '/': return Token( Token::token_t::OPERATOR, Token::operator_t::SLASH );
+                    case '%': return Token( Token::token_t::OPERATOR, Token::operator_t::MOD );
+                    default : return Token( Token::token_t::OPERATOR, Token::operator_t::CARRET );
+                }
+            }
+
+            //<! Token da constante v_
+            static Token operand_token( Bares::value_type v_ )
+            {  return Token( Token::token_t::OPERAND, Token::operator_t::NONE, static_cast< std::int16_t >( v_ ) ); }
+
+            //<! <expr> sem erros, com até depth_ níveis de parênteses, e o seu valor
+            std::string expression( int depth_, Bares::value_type & value_ )
+            {
+                //O nível atual é avaliado como uma cadeia plana de Tokens, com o
+                //valor de cada "( ... )" no lugar dele. Cada "operador termo" só
+                //entra se a cadeia continuar válida; as escolhas que estouram ou
+                //dividem por zero são sorteadas de novo.
+                std::vector< Token > chain;
+                std::string e = term( depth_, value_ );
+                chain.push_back( operand_token( value_ ) );
+
+                for ( int i = uniform( cfg.min_terms, cfg.max_terms ) - 1; i > 0; --i )
+                {
+                    for ( int attempt = 0; attempt < 8; ++attempt )
+                    {
+                        char c = op();
+                        Bares::value_type tv;
+                        std::string t = term( depth_, tv );
+                        chain.push_back( operator_token( c ) );
+                        chain.push_back( operand_token( tv ) );
+
+                        auto r = bares.evaluate( chain );
+                        if ( r.type_b == Bares::Result::OK )
+                        {
+                            e += ws() + c + ws() + t;
+                            value_ = r.value_b;
+                            break;
+                        }
+                        chain.resize( chain.size() - 2 );
+                    }
+                }
+                return e;
+            }
+
+            //<! <term> e o seu valor
+            std::string term( int depth_, Bares::value_type & value_ )
+            {
+                if ( depth_ > 0 and chance( cfg.paren ) )
+                    return "(" + ws() + expression( depth_ - 1, value_ ) + ws() + ")";
+                return literal( value_ );
+            }
+
+            //<! Uma expressão sem erros
+            std::string valid( void )
+            {
+                Bares::value_type v;
+                return expression( cfg.depth, v );
+            }
+
+            //<! Caractere que não pode iniciar uma constante
+            char bad_char( void )
+            {
+                static const char bad[] = "#$.=abcxyz!&?";
+                return bad[ uniform( 0, sizeof( bad ) - 2 ) ];
+            }
+
+            //<! Constante fora de required_int_type
+            std::string out_of_range_literal( void )
+            {
+                long v = chance( 0.5 ) ? long( short_limits::max() ) + uniform( 1, 100000 )
+                                       : long( short_limits::min() ) - uniform( 1, 100000 );
+                return std::to_string( v );
+            }
+
+            //<! Monta uma linha com o resultado pedido
+            std::string build( outcome_t target_ )
+            {
+                switch ( target_ )
+                {
+                    case END:
+                        return ws() + ( chance( 0.3 ) ? "(" + ws() : "" );
+                    case ILL_FORMED:
+                        return valid() + ws() + op() + ws() + bad_char() + literal();
+                    case MISSING_TERM:
+                        return valid() + ws() + op() + ws();
+                    case EXTRANEOUS:
+                        return valid() + " " + ws() + ( chance( 0.5 ) ? literal() : std::string( 1, ")=x"[ uniform( 0, 2 ) ] ) );
+                    case MISSING_PAREN:
+                        return "(" + ws() + valid() + ws() + ( chance( 0.5 ) ? op() + ws() + literal() : "" );
+                    case OUT_OF_RANGE:
+                        return valid() + ws() + op() + ws() + out_of_range_literal();
+                    case DIV_ZERO:
+                    {
+                        std::string k = std::to_string( uniform( 1, 999 ) );
+                        return "(" + valid() + ")" + ws() + ( chance( 0.5 ) ? "/" : "%" ) + ws()
+                               + "(" + k + ws() + "-" + ws() + k + ")";
+                    }
+                    case NUM_OVERFLOW:
+                    {
+                        //a * b com produto acima de required_int_type
+                        int a = uniform( 182, 32767 );
+                        int b = short_limits::max() / a + uniform( 1, 10 );
+                        return "(" + valid() + ")" + ws() + "+" + ws()
+                               + std::to_string( a ) + ws() + "*" + ws() + std::to_string( b );
+                    }
+                    default:
+                        return valid();
+                }
+            }
+
+            //<! Linha fixa com o resultado pedido (quando as tentativas falham)
+            std::string fallback( outcome_t target_ )
+            {
+                static const char * const fixed[ N_OUTCOMES ] = {
+                    "1 + 1", "   ", "1 + #1", "1 +", "1 1", "(1 + 1", "1 + 40000", "1 / 0", "200 * 200"
+                };
+                return fixed[ target_ ];
+            }
+    };
+
+    //<! Lê "MIN:MAX"
+    bool parse_range( const char * s_, int & lo_, int & hi_ )
+    {
+        return std::sscanf( s_, "%d:%d", &lo_, &hi_ ) == 2 and lo_ <= hi_;
+    }
+
+    //<! Lê "+:3,-:3,..."
+    bool parse_ops( const std::string & s_, Config & cfg_ )
+    {
+        cfg_.ops.clear();
+        cfg_.op_weights.clear();
+        std::istringstream in( s_ );
+        std::string item;
+        while ( std::getline( in, item, ',' ) )
+        {
+            if ( item.size() < 3 or item[1] != ':' or std::string( "+-*/%^" ).find( item[0] ) == std::string::npos )
+                return false;
+            cfg_.ops += item[0];
+            cfg_.op_weights.push_back( std::stod( item.substr( 2 ) ) );
+        }
+        return not cfg_.ops.empty();
+    }
+
+    //<! Lê "NOME=P"
+    bool parse_error( const std::string & s_, Config & cfg_ )
+    {
+        auto eq = s_.find( '=' );
+        if ( eq == std::string::npos )
+            return false;
+        for ( int k = 1; k < N_OUTCOMES; ++k )
+            if ( s_.compare( 0, eq, outcome_names[k] ) == 0 )
+            {
+                cfg_.fraction[k] = std::stod( s_.substr( eq + 1 ) );
+                return true;
+            }
+        return false;
+    }
+}
+
+int main( int argc, char * argv[] )
+{
+    Config cfg;
+    bool ok = true;
+    for ( int i = 1; i < argc and ok; ++i )
+    {
+        bool has_arg = i + 1 < argc;
+        if ( std::strcmp( argv[i], "--lines" ) == 0 and has_arg )
+            cfg.lines = std::stoul( argv[++i] );
+        else if ( std::strcmp( argv[i], "--seed" ) == 0 and has_arg )
+            cfg.seed = static_cast< std::uint32_t >( std::stoul( argv[++i] ) );
+        else if ( std::strcmp( argv[i], "--output" ) == 0 and has_arg )
+            cfg.output = argv[++i];
+        else if ( std::strcmp( argv[i], "--expected" ) == 0 and has_arg )
+            cfg.expected = argv[++i];
+        else if ( std::strcmp( argv[i], "--terms" ) == 0 and has_arg )
+            ok = parse_range( argv[++i], cfg.min_terms, cfg.max_terms ) and cfg.min_terms >= 1;
+        else if ( std::strcmp( argv[i], "--depth" ) == 0 and has_arg )
+            cfg.depth = std::stoi( argv[++i] );
+        else if ( std::strcmp( argv[i], "--paren" ) == 0 and has_arg )
+            cfg.paren = std::stod( argv[++i] );
+        else if ( std::strcmp( argv[i], "--ops" ) == 0 and has_arg )
+            ok = parse_ops( argv[++i], cfg );
+        else if ( std::strcmp( argv[i], "--literals" ) == 0 and has_arg )
+            ok = parse_range( argv[++i], cfg.min_literal, cfg.max_literal )
+                 and cfg.min_literal >= short_limits::min() and cfg.max_literal <= short_limits::max();
+        else if ( std::strcmp( argv[i], "--edge" ) == 0 and has_arg )
+            cfg.edge = std::stod( argv[++i] );
+        else if ( std::strcmp( argv[i], "--spaces" ) == 0 and has_arg )
+            cfg.spaces = std::stoi( argv[++i] );
+        else if ( std::strcmp( argv[i], "--error" ) == 0 and has_arg )
+            ok = parse_error( argv[++i], cfg );
+        else
+            ok = false;
+    }
+
+    double total = 0;
+    for ( int k = 1; k < N_OUTCOMES; ++k )
+        total += cfg.fraction[k];
+
+    if ( not ok or total > 1.0 )
+    {
+        std::fprintf( stderr, "Uso: %s [--lines N] [--seed S] [--output ARQUIVO] [--expected ARQUIVO]\n"
+                              "       [--terms MIN:MAX] [--depth D] [--paren P] [--ops \"+:w,...\"]\n"
+                              "       [--literals MIN:MAX] [--edge P] [--spaces MAX] [--error NOME=P ...]\n"
+                              "NOME: end, ill_formed, missing_term, extraneous, missing_paren,\n"
+                              "      out_of_range, div_zero, overflow (soma das frações <= 1)\n", argv[0] );
+        return EXIT_FAILURE;
+    }
+
+    std::ios::sync_with_stdio( false );
+    std::ofstream file;
+    if ( not cfg.output.empty() )
+        file.open( cfg.output );
+    std::ostream & out = cfg.output.empty() ? std::cout : file;
+
+    std::ofstream expected;
+    Evaluator evaluator;
+    if ( not cfg.expected.empty() )
+        expected.open( cfg.expected );
+
+    Generator gen( cfg );
+    for ( std::size_t n = 0; cfg.lines == 0 or n < cfg.lines; ++n )
+    {
+        std::string l = gen.line();
+        out << l << '\n';
+        if ( expected.is_open() )
+            evaluator.eval( l, expected );
+        if ( not out )
+            break; //Leitor fechou o pipe
+    }
+
+    return EXIT_SUCCESS;
+}